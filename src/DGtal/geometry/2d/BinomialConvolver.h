@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <map>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Signal.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -124,10 +125,35 @@ namespace DGtal
 	       const ConstIteratorOnPoints& ite,
 	       const bool isClosed );
 
+    /**
+       Initializes the convolver with a contiguous array of points,
+       which is not referenced afterwards. Geometric data are then
+       accessed by index only (methods x, dx, d2x, tangent,
+       curvature), since there is no iterator.
+
+       @tparam TPoint any type of point whose components are
+       convertible into a double.
+
+       @param h grid size (must be >0).
+       @param points the array of points.
+       @param nb the number of points in the array.
+       @param isClosed true if the input range is viewed as closed.
+
+       The object is then valid.
+    */
+    template <typename TPoint>
+    void init( const double h, 
+	       const TPoint* points, unsigned int nb,
+	       const bool isClosed );
+
     /**
        Given a valid iterator [it], return the corresponding index
        position in the binomial convolver in logarithmic time. The
-       method init should have been called before.
+       method init should have been called before. The mapping from
+       iterators to indices is only built at the first call (hence
+       the first call is not thread-safe), and is not needed when
+       evaluating the whole range with
+       BinomialConvolverEstimator::eval.
 
        @see init
        
@@ -136,6 +162,16 @@ namespace DGtal
     */
     int index( const ConstIteratorOnPoints& it ) const;
 
+    /**
+       @return the number of points of the convolved contour.
+    */
+    unsigned int nbPoints() const;
+
+    /**
+       @return the begin iterator given at initialization.
+    */
+    const ConstIteratorOnPoints & begin() const;
+
     /**
      * @param i any index.
      *
@@ -209,8 +245,8 @@ namespace DGtal
     ///Copy of the end iterator
     ConstIteratorOnPoints myEnd;
 
-    // Stores the mapping Iterator => Index.
-    std::map<ConstIteratorOnPoints,int> myMapIt2Idx;
+    // Stores the mapping Iterator => Index, computed on demand by index.
+    mutable std::map<ConstIteratorOnPoints,int> myMapIt2Idx;
 
     // ------------------------- Private Datas --------------------------------
   private:
@@ -218,6 +254,13 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
+    /**
+       Convolves the signals myX and myY and computes their
+       derivatives.
+       @param h grid size (must be >0).
+    */
+    void convolve( const double h );
+
   private:
 
     /**
@@ -269,6 +312,14 @@ namespace DGtal
     Value operator()( const BinomialConvolver & bc,
 		      const ConstIteratorOnPoints & it ) const;
 
+    /**
+       Operator() 
+       
+       @param i any index in the current BinomialConvolver.
+       @return the tangent vector at position [i].
+     */
+    Value operator()( const BinomialConvolver & bc, int i ) const;
+
   };
 
   /**
@@ -300,6 +351,14 @@ namespace DGtal
     Value operator()( const BinomialConvolver & bc,
 		      const ConstIteratorOnPoints & it ) const;
 
+    /**
+       Operator() 
+       
+       @param i any index in the current BinomialConvolver.
+       @return the curvature at position [i].
+     */
+    Value operator()( const BinomialConvolver & bc, int i ) const;
+
   };
 
   /**
@@ -310,7 +369,9 @@ namespace DGtal
      
      @tparam TBinomialConvolver any BinomialConvolver.
 
-     @tparam TRealPoint the type for representing the tangent vector.
+     @tparam TBinomialConvolverFunctor a functor on the binomial
+     convolver, taking either an iterator or an index (like
+     TangentFromBinomialConvolverFunctor).
   */
   template <typename TBinomialConvolver, typename TBinomialConvolverFunctor>
   class BinomialConvolverEstimator
@@ -347,6 +408,9 @@ namespace DGtal
     /**
      * @return the estimated quantity
      * from itb till ite (exculded)
+     *
+     * Indices are incremented along with the iterators, so that
+     * the whole contour is evaluated in linear time.
      */
     template <typename OutputIterator>
     OutputIterator eval( const ConstIterator& itb, 
@@ -0,0 +1,269 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChainCodeDSS.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/29
+ *
+ * Header file for module ChainCodeDSS.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChainCodeDSS_RECURSES)
+#error Recursive header files inclusion detected in ChainCodeDSS.h
+#else // defined(ChainCodeDSS_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChainCodeDSS_RECURSES
+
+#if !defined ChainCodeDSS_h
+/** Prevents repeated inclusion of headers. */
+#define ChainCodeDSS_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChainCodeDSS
+  /**
+     Description of template class 'ChainCodeDSS' <p>
+     \brief Aim: Dynamic recognition of a digital straight segment
+     (DSS), as ArithmeticalDSS, when the points are given by a chain
+     code: the sequence of points (x,y) such that mu <= ax - by < mu +
+     omega.
+
+     Since the steps of the curve belong to a tiny alphabet (4 or 8
+     codes), the step of a code is read in a table, the two possible
+     steps of the DSS are stored as a bit mask, and the remainders
+     are computed on integers, relatively to the first point. The
+     common case of a point strictly inside the DSS is detected with
+     one test. The characteristics (a, b, mu, omega) and the leaning
+     points are the ones computed by ArithmeticalDSS on the same
+     points. The DSS may only be extended at its front.
+
+     The codes are the ones of FreemanChain for 4-connected curves: 0
+     (east), 1 (north), 2 (west), 3 (south). For 8-connected curves,
+     they are numbered from 0 (east) to 7 (south-east)
+     counterclockwise. In strings, they are written as characters '0',
+     '1', etc.
+
+     @tparam TInteger the type of the coordinates and characteristics.
+     @tparam connectivity 4 or 8.
+
+     @code
+     FreemanChain<int> fc( "0001000100010", 0, 0 );
+     ChainCodeDSS<int,4> dss;
+     ChainCodeDSS<int,4>::Size n = dss.longestPrefix( Z2i::Point( fc.x0, fc.y0 ),
+                                                      fc.chain, 0 );
+     std::cout << n << " codes: " << dss << std::endl;
+     @endcode
+  */
+  template <typename TInteger, int connectivity>
+  class ChainCodeDSS
+  {
+  public:
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef std::size_t Size;
+
+    /// The number of codes of the alphabet.
+    static const unsigned int NB_CODES = connectivity;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~ChainCodeDSS();
+
+    /**
+     * Constructor. The DSS is the point (0,0).
+     */
+    ChainCodeDSS();
+
+    /**
+       Initializes the DSS with one point.
+       @param p the first point of the DSS.
+    */
+    void init( const Point & p );
+
+    /**
+       Adds the point following the front of the DSS by the step of
+       [code], if the result is still a DSS.
+
+       @param code a code between 0 and NB_CODES-1.
+       @return 'true' if the point was added, 'false' otherwise (the
+       DSS is then unchanged).
+    */
+    bool extend( unsigned int code );
+
+    /**
+       Initializes the DSS at [p] and extends it with the codes of
+       [codes] read from position [pos], as long as possible.
+
+       @param p the point before the code at position [pos].
+       @param codes a chain code, as a string of '0', '1', etc.
+       @param pos the position of the first code read.
+       @param isClosed when 'true', the codes are read circularly, at
+       most once each.
+       @return the number of codes read, i.e. the number of points
+       of the DSS minus one.
+    */
+    Size longestPrefix( const Point & p, const std::string & codes,
+			Size pos, bool isClosed = false );
+
+    /**
+       Computes, for each starting position, the number of codes of
+       the longest DSS read from it. The positions are processed in
+       parallel when OpenMP is enabled.
+
+       @param codes a chain code, as a string of '0', '1', etc.
+       @param isClosed when 'true', the codes are read circularly.
+       @param positions the starting positions.
+       @param lengths (returns) the number of codes of the longest DSS
+       starting at each position.
+    */
+    static void longestPrefixes( const std::string & codes, bool isClosed,
+				 const std::vector<Size> & positions,
+				 std::vector<Size> & lengths );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the parameter a.
+    Integer getA() const;
+
+    /// @return the parameter b.
+    Integer getB() const;
+
+    /// @return the parameter mu.
+    Integer getMu() const;
+
+    /// @return the parameter omega.
+    Integer getOmega() const;
+
+    /// @return the first upper leaning point.
+    Point getUf() const;
+
+    /// @return the last upper leaning point.
+    Point getUl() const;
+
+    /// @return the first lower leaning point.
+    Point getLf() const;
+
+    /// @return the last lower leaning point.
+    Point getLl() const;
+
+    /// @return the first point of the DSS.
+    Point getBackPoint() const;
+
+    /// @return the last point of the DSS.
+    Point getFrontPoint() const;
+
+    /// @return the number of codes of the DSS (its number of points minus one).
+    Size size() const;
+
+    /**
+       @param code a code between 0 and NB_CODES-1.
+       @return the displacement of [code].
+    */
+    static Vector step( unsigned int code );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The characteristics, mu being relative to the first point.
+    Integer myA, myB, myMu, myOmega;
+    /// The first point.
+    Point myOrigin;
+    /// The leaning points and the last point, relative to the first point.
+    Point myUf, myUl, myLf, myLl, myLast;
+    /// The codes of the DSS, one bit per code.
+    unsigned int mySteps;
+    /// The first code of the DSS.
+    unsigned int myFirstCode;
+    /// The number of codes.
+    Size mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param a any integer.
+       @param b any integer.
+       @return the norm of (a,b) giving omega: |a|+|b| for
+       4-connectivity, max(|a|,|b|) for 8-connectivity.
+    */
+    static Integer norm( Integer a, Integer b );
+
+  }; // end of class ChainCodeDSS
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChainCodeDSS'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChainCodeDSS' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger, int connectivity>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const ChainCodeDSS<TInteger, connectivity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/2d/ChainCodeDSS.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChainCodeDSS_h
+
+#undef ChainCodeDSS_RECURSES
+#endif // else defined(ChainCodeDSS_RECURSES)
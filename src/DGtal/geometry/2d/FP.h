@@ -41,7 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
-#include <list>
+#include <vector>
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/RealPointVector.h"
 #include "DGtal/geometry/2d/ArithmeticalDSS.h"
@@ -54,67 +54,19 @@
 namespace DGtal
 {
 
-	/////////////////////////////////////////////////////////////////////////////
-	// template class adapterDSS,
-	// which is a tool class for FP
-	template <typename ArithmeticalDSS>
-	class Adapter 
-	{
-		protected:
-			ArithmeticalDSS* myDSS;
-		public:
-			virtual typename ArithmeticalDSS::Point firstLeaningPoint() const = 0;
-			virtual typename ArithmeticalDSS::Point lastLeaningPoint() const = 0;
-	};
-
-	template <typename ArithmeticalDSS>
-	class Adapter4ConvexPart : public Adapter<ArithmeticalDSS> 
-	{
-		public:
-			//constructor
-			Adapter4ConvexPart(ArithmeticalDSS& aDSS)
-			{
-				this->myDSS = &aDSS;
-			}
-			//accessors
-			virtual typename ArithmeticalDSS::Point firstLeaningPoint() const 
-			{
-				return this->myDSS->getUf();
-			}
-			virtual typename ArithmeticalDSS::Point lastLeaningPoint() const
-			{
-				return this->myDSS->getUl();
-			}
-	};
-
-	template <typename ArithmeticalDSS>
-	class Adapter4ConcavePart : public Adapter<ArithmeticalDSS> 
-	{
-		public:
-			//constructor
-			Adapter4ConcavePart(ArithmeticalDSS& aDSS)
-			{
-				this->myDSS = &aDSS;
-			}
-			//accessors
-			virtual typename ArithmeticalDSS::Point firstLeaningPoint() const 
-			{
-				return this->myDSS->getLf();
-			}
-			virtual typename ArithmeticalDSS::Point lastLeaningPoint() const
-			{
-				return this->myDSS->getLl();
-			}
-	};
-	/////////////////////////////////////////////////////////////////////////////
-
-
   /////////////////////////////////////////////////////////////////////////////
   // template class FP
   /**
    * Description of template class 'FP' <p>
    * \brief Aim:Computes the faithful polygon (FP)
    * of a range of 4/8-connected 2D Points. 
+   *
+   * The vertices of the FP are stored in a vector, together with
+   * their index in the range, so that length, area or convexity
+   * estimators may use the polygon without copying it. The vertices
+   * of the minimum length polygon (MLP) are deduced from the ones of
+   * the FP on demand (see mlpVertex). An FP may be computed again
+   * with init, reusing its memory.
    */
   template <typename TIterator, typename TInteger, int connectivity>
   class FP
@@ -134,13 +86,19 @@ namespace DGtal
   typedef DGtal::ArithmeticalDSS<TIterator,TInteger,connectivity> DSSComputer;
   typedef DGtal::ArithmeticalDSS<DGtal::Circulator<TIterator>,TInteger,connectivity> DSSComputerInLoop;
 
-	typedef std::list<Point> Polygon;
+	typedef std::vector<Point> Polygon;
+	typedef std::size_t Size;
 
 
 
     // ----------------------- Standard services ------------------------------
   public:
 
+    /**
+     * Default constructor. The FP is empty.
+     */
+    FP();
+
     /**
      * Constructor.
      * @param itb begin iterator
@@ -150,6 +108,16 @@ namespace DGtal
      */
     FP(const TIterator& itb, const TIterator& ite, const bool& isClosed) throw( InputException ) ;
 
+    /**
+     * Computes the FP of a range. The previous vertices are
+     * forgotten, but memory is reused.
+     * @param itb begin iterator
+     * @param ite end iterator
+     * @param isClosed 'true' if the range has to be considered as circular, 
+     * 'false' otherwise. 
+     */
+    void init(const TIterator& itb, const TIterator& ite, const bool& isClosed) throw( InputException ) ;
+
     /**
      * Destructor.
      */
@@ -171,6 +139,27 @@ namespace DGtal
      */
     typename Polygon::size_type size() const;
 
+    /**
+     * @return 'true' if the range was considered as circular.
+     */
+    bool isClosed() const;
+
+    /**
+     * @return the vertices of the FP.
+     */
+    const Polygon & vertices() const;
+
+    /**
+     * @return the index in the range of each vertex of the FP.
+     */
+    const std::vector<Size> & indices() const;
+
+    /**
+     * @param i the index of a vertex of the FP.
+     * @return the [i]-th vertex of the MLP.
+     */
+    RealPoint mlpVertex( Size i ) const;
+
 
     /**
      * @return the vertices of the FP
@@ -192,8 +181,14 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
-		//each vertex of the FP is stored in this list
+		//each vertex of the FP is stored in this vector
 		Polygon myPolygon; 
+		//index of each vertex of the FP in the range
+		std::vector<Size> myIndices;
+		//workspace for the lower leaning points of open ranges
+		Polygon myLowerPoints;
+		//index of each lower leaning point in the range
+		std::vector<Size> myLowerIndices;
 
 		//TRUE if the list has to be consider as circular
     //FALSE otherwise
@@ -208,29 +203,56 @@ namespace DGtal
 
     /**
      * @param [aDSS] a DSS lying on a range
-     * @param [anAdapter] an Adapter to [aDSS] for convex part
-     * if 'true' is returned, for concave part otherwise
      * @param [i] an iterator pointing after the front of [aDSS] 
      * @return 'true' if [aDSS] begins a convex part, 'false' otherwise
      */
-    template<typename DSS, typename Adapter>
-    bool initConvexityConcavity( DSS &aDSS,  
-                                 Adapter* &anAdapter,
-                                 const typename DSS::ConstIterator& i );
+    template<typename DSS>
+    bool initConvexityConcavity( const DSS &aDSS,  
+                                 const typename DSS::ConstIterator& i ) const;
+
+    /**
+     * @param [aDSS] a DSS lying on a range
+     * @param [isConvex], 'true' if [aDSS] is in a convex part, 'false' otherwise
+     * @return the first upper leaning point of [aDSS] in a convex
+     * part, its first lower leaning point otherwise.
+     */
+    template<typename DSS>
+    static Point firstLeaningPoint( const DSS &aDSS, bool isConvex );
+
+    /**
+     * @param [aDSS] a DSS lying on a range
+     * @param [isConvex], 'true' if [aDSS] is in a convex part, 'false' otherwise
+     * @return the last upper leaning point of [aDSS] in a convex
+     * part, its last lower leaning point otherwise.
+     */
+    template<typename DSS>
+    static Point lastLeaningPoint( const DSS &aDSS, bool isConvex );
 
     /**
      * @param [currentDSS] a DSS lying on a range
-     * @param [adapter] an Adapter to [currentDSS]
      * @param [isConvex], 'true' if [currentDSS] is in a convex part, 'false' otherwise
      * @param [i] an iterator pointing after the front of [currentDSS] 
+     * @param [index] the index of [i] in the range
      * @param the algorithm stops when [i] == [end]
      */
-    template<typename DSS, typename Adapter>
-    void mainAlgorithm( DSS &currentDSS, Adapter* adapter, 
+    template<typename DSS>
+    void mainAlgorithm( DSS &currentDSS, 
                         bool isConvex, 
                         typename DSS::ConstIterator i, 
+                        Size index, 
                         const typename DSS::ConstIterator& end )  throw( InputException ) ;
 
+    /**
+     * Appends a leaning point of a DSS and its index to a polygon.
+     * @param [aDSS] a DSS lying on a range
+     * @param [p] a point of [aDSS]
+     * @param [frontIndex] the index of the front of [aDSS] in the range
+     * @param [aPolygon] (modified) the polygon receiving [p]
+     * @param [someIndices] (modified) the indices receiving the index of [p]
+     */
+    template<typename DSS>
+    static void pushVertex( const DSS &aDSS, const Point& p, Size frontIndex, 
+                            Polygon& aPolygon, std::vector<Size>& someIndices );
 
     /**
      * gets a MLP vertex from three consecutive vertices of the FP.
@@ -0,0 +1,232 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FlatGreedyDecomposition.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/10/01
+ *
+ * Header file for module FlatGreedyDecomposition.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FlatGreedyDecomposition_RECURSES)
+#error Recursive header files inclusion detected in FlatGreedyDecomposition.h
+#else // defined(FlatGreedyDecomposition_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FlatGreedyDecomposition_RECURSES
+
+#if !defined FlatGreedyDecomposition_h
+/** Prevents repeated inclusion of headers. */
+#define FlatGreedyDecomposition_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FlatGreedyDecomposition
+  /**
+     Description of template class 'FlatGreedyDecomposition' <p>
+     \brief Aim: Computes the same greedy decomposition of a sequence
+     into segments as GreedyDecomposition, in one pass, and stores
+     it as a flat array of break indices.
+
+     A single segment computer is used as a workspace: each segment
+     is extended until the first failure, then the workspace is
+     initialized at the last point of the segment and extended with
+     the next one, which both tells whether the two segments intersect
+     and starts the next segment. No segment is copied during the
+     computation. For a closed curve, the last segment is extended
+     with the first point, as in GreedyDecomposition, and the curve
+     is not scanned again. The segments themselves are given on
+     demand by segment( i ), in time proportional to their length.
+
+     The [i]-th segment contains the elements of indices back( i ) to
+     front( i ) - 1 (and the first element when it is the last segment
+     of a closed curve that intersects the first one).
+
+     @tparam TSegment a model of CSegmentComputer, as for
+     GreedyDecomposition. Its ConstIterator must be at least
+     bidirectional.
+
+     @code
+     typedef ArithmeticalDSS<ConstIterator,int,4> DSS4;
+     FlatGreedyDecomposition<DSS4> dec;
+     dec.compute( curve.begin(), curve.end(), DSS4(), true );
+     for ( unsigned int i = 0; i < dec.size(); ++i )
+       std::cout << dec.back( i ) << " " << dec.segment( i ) << std::endl;
+     @endcode
+  */
+  template <typename TSegment>
+  class FlatGreedyDecomposition
+  {
+  public:
+    typedef TSegment Segment;
+    typedef typename Segment::ConstIterator ConstIterator;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~FlatGreedyDecomposition();
+
+    /**
+     * Constructor. The decomposition is empty.
+     */
+    FlatGreedyDecomposition();
+
+    /**
+       Computes the greedy decomposition of the range [aBegin,aEnd).
+       Previous segments are forgotten, but memory is reused.
+
+       @param aBegin begin iterator on a digital curve.
+       @param aEnd end iterator on a digital curve.
+       @param aSegment a segment computer, copied once as workspace.
+       @param isClosed when 'true', the curve is processed as closed.
+    */
+    void compute( const ConstIterator & aBegin, const ConstIterator & aEnd,
+		  const Segment & aSegment, bool isClosed );
+
+    /// @return the number of segments.
+    Size size() const;
+
+    /**
+       @param i the index of a segment.
+       @return the index of its first element.
+    */
+    Size back( Size i ) const;
+
+    /**
+       @param i the index of a segment.
+       @return the index after its last element.
+    */
+    Size front( Size i ) const;
+
+    /**
+       @param i the index of a segment.
+       @return 'true' if the [i]-th segment intersects the next one.
+    */
+    bool intersectNext( Size i ) const;
+
+    /**
+       @param i the index of a segment.
+       @return 'true' if the [i]-th segment intersects the previous one.
+    */
+    bool intersectPrevious( Size i ) const;
+
+    /**
+       @param i the index of a segment.
+       @return the [i]-th segment, recomputed by extension.
+    */
+    Segment segment( Size i ) const;
+
+    /// @return the index after the last element of each segment.
+    const std::vector<Size> & breaks() const;
+
+    /// @return 'true' if the curve was processed as closed.
+    bool isClosed() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The segment computer used as a workspace.
+    Segment mySegment;
+    /// The range of the curve.
+    ConstIterator myBegin, myEnd;
+    /// 'true' if the curve is closed.
+    bool myIsClosed;
+    /// The index after the last element of each segment.
+    std::vector<Size> myBreaks;
+    /// For each segment, 'true' if it intersects the next one.
+    std::vector<bool> myIntersectNext;
+    /// 'true' if the first segment intersects the last one (closed curves).
+    bool myIntersectFirst;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    FlatGreedyDecomposition ( const FlatGreedyDecomposition & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    FlatGreedyDecomposition & operator= ( const FlatGreedyDecomposition & other );
+
+  }; // end of class FlatGreedyDecomposition
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FlatGreedyDecomposition'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FlatGreedyDecomposition' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegment>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const FlatGreedyDecomposition<TSegment> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/2d/FlatGreedyDecomposition.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FlatGreedyDecomposition_h
+
+#undef FlatGreedyDecomposition_RECURSES
+#endif // else defined(FlatGreedyDecomposition_RECURSES)
@@ -0,0 +1,368 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/25
+ *
+ * Header file for module PackedFreemanChain.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicTypes.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+     Description of template class 'PackedFreemanChain' <p>
+     \brief Aim: Describes a digital 4-connected contour as
+     FreemanChain, but stores its codes on 2 bits (32 codes per 64-bit
+     word), i.e. four times less memory than the string of
+     FreemanChain.
+
+     The global computations (last point, bounding box, closedness,
+     area) read the codes four by four: each byte of codes is looked up
+     in a table giving its displacement, the bounding box of its
+     points, its contribution to the area and its turns. The points of
+     the contour may also be decoded in bulk with getContourPoints, or
+     one by one with ConstIterator.
+
+     The code of a move is the one of FreemanChain: 0 (east), 1
+     (north), 2 (west), 3 (south).
+
+     @tparam TInteger the type of the coordinates of the points.
+
+     @code
+     FreemanChain<int> fc( "00001111222233", 0, 0 );
+     PackedFreemanChain<int> pfc( fc );
+     int minX, minY, maxX, maxY;
+     pfc.computeBoundingBox( minX, minY, maxX, maxY );
+     DGtal::int64_t area = pfc.area();
+     @endcode
+  */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+  public:
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> PointI2;
+    typedef DGtal::uint64_t Word;
+    typedef std::size_t Size;
+
+    /// The number of codes stored in a word.
+    static const unsigned int CODES_PER_WORD = 32;
+
+    /**
+       The characteristics of a sequence of four codes (a byte of
+       codes), the coordinates being relative to its first point.
+    */
+    struct ByteInfo
+    {
+      /// The displacement after the four moves.
+      int dx, dy;
+      /// The bounding box of the five points.
+      int minX, minY, maxX, maxY;
+      /// The sum of x.dy over the four moves.
+      int area;
+      /// The number of ccw turns minus the number of cw turns between
+      /// the four codes.
+      int turns;
+      /// 'true' if two consecutive codes are opposite.
+      bool uTurn;
+      /// The points after each move.
+      int x[ 4 ], y[ 4 ];
+    };
+
+    // ------------------------- iterator ------------------------------
+  public:
+
+    /**
+       A forward iterator on the points of the chain, decoding the
+       codes of the current word one by one. There are size()+1
+       points, as in FreemanChain.
+    */
+    class ConstIterator
+      : public std::iterator<std::forward_iterator_tag, PointI2,
+			     int, const PointI2*, const PointI2 &>
+    {
+    public:
+      /// Default constructor. The object is not valid.
+      ConstIterator();
+
+      /**
+         Constructor of the iterator at the first point of [aChain].
+         @param aChain a packed Freeman chain.
+      */
+      ConstIterator( const PackedFreemanChain & aChain );
+
+      /**
+         Constructor of the iterator past the last point of [aChain].
+         @param aChain a packed Freeman chain.
+         @param lastPoint the last point of the chain.
+      */
+      ConstIterator( const PackedFreemanChain & aChain,
+		     const PointI2 & lastPoint );
+
+      /// @return the current point.
+      const PointI2 & operator*() const;
+
+      /// @return a pointer to the current point.
+      const PointI2 * operator->() const;
+
+      /// Moves to the next point (pre-increment).
+      ConstIterator & operator++();
+
+      /// Moves to the next point (post-increment).
+      ConstIterator operator++( int );
+
+      /**
+         @param other any iterator on the same chain.
+         @return 'true' if both iterators point at the same position.
+      */
+      bool operator==( const ConstIterator & other ) const;
+
+      /**
+         @param other any iterator on the same chain.
+         @return 'true' if both iterators point at different positions.
+      */
+      bool operator!=( const ConstIterator & other ) const;
+
+      /// @return the position of the current point (0 to size()).
+      Size position() const;
+
+      /// @return the code of the move from the current point.
+      unsigned int code() const;
+
+    private:
+      /// The visited chain.
+      const PackedFreemanChain* myChain;
+      /// The position of the current point.
+      Size myPos;
+      /// The codes from the current one to the end of the word.
+      Word myWord;
+      /// The current point.
+      PointI2 myXY;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~PackedFreemanChain();
+
+    /**
+     * Constructor.
+     * @param s the chain code, as a string of '0', '1', '2' and '3'.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string & s = "",
+			Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a FreemanChain.
+     * @param fc any Freeman chain.
+     */
+    PackedFreemanChain( const FreemanChain<TInteger> & fc );
+
+    /**
+       Sets the first point and the chain code.
+       @param s the chain code, as a string of '0', '1', '2' and '3'.
+       @param x the x-coordinate of the first point.
+       @param y the y-coordinate of the first point.
+    */
+    void init( const std::string & s, Integer x, Integer y );
+
+    /**
+       Appends a move at the end of the chain. The last point is
+       updated in O(1).
+       @param aCode a Freeman code (between 0-3).
+    */
+    void push_back( unsigned int aCode );
+
+    /**
+       @param fc (returns) the same contour as a FreemanChain.
+    */
+    void getFreemanChain( FreemanChain<TInteger> & fc ) const;
+
+    /**
+       @param aVContour (returns) the size()+1 points of the contour,
+       as FreemanChain::getContourPoints. They are decoded four by
+       four.
+    */
+    void getContourPoints( std::vector<PointI2> & aVContour ) const;
+
+    /// @return the number of codes of the chain.
+    Size size() const;
+
+    /// @return 'true' if the chain has no code.
+    bool empty() const;
+
+    /**
+       @param pos a position in the chain code.
+       @return the code at position [pos].
+    */
+    unsigned int code( Size pos ) const;
+
+    /// @return the first point of the chain.
+    PointI2 firstPoint() const;
+
+    /// @return the last point of the chain.
+    PointI2 lastPoint() const;
+
+    /// @return the codes, 32 per word, the first code on the lowest bits.
+    const std::vector<Word> & words() const;
+
+    /// @return an iterator pointing on the first point of the chain.
+    ConstIterator begin() const;
+
+    /// @return an iterator pointing after the last point of the chain.
+    ConstIterator end() const;
+
+    // ----------------------- Geometric services -----------------------------
+  public:
+
+    /**
+     * Computes a bounding box for the Freeman chain code.
+     *
+     * @param min_x (returns) the minimal x-coordinate.
+     * @param min_y (returns) the minimal y-coordinate.
+     * @param max_x (returns) the maximal x-coordinate.
+     * @param max_y (returns) the maximal y-coordinate.
+     */
+    void computeBoundingBox( Integer & min_x, Integer & min_y,
+			     Integer & max_x, Integer & max_y ) const;
+
+    /**
+       Same as FreemanChain::isClosed.
+
+       @return the number of counterclockwise loops, or '0' if the
+       contour is open or invalid (it has a U-turn).
+    */
+    int isClosed() const;
+
+    /**
+       @return the signed area of the polygon of the contour,
+       positive when it is counterclockwise (computed as the sum of
+       x.dy over the moves). Meaningful for closed contours only.
+    */
+    DGtal::int64_t area() const;
+
+    /**
+       @return the length of the contour, i.e. the number of its
+       unit moves.
+    */
+    Size perimeter() const;
+
+    /**
+       @return the table of the characteristics of the 256 bytes of
+       codes.
+    */
+    static const ByteInfo* byteTable();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The codes, 32 per word.
+    std::vector<Word> myWords;
+    /// The number of codes.
+    Size mySize;
+    /// The first point.
+    PointI2 myFirst;
+    /// The last point.
+    PointI2 myLast;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param i the index of a byte of codes (the 4i-th to 4i+3-th codes).
+       @return its value.
+    */
+    unsigned int byte( Size i ) const;
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/2d/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
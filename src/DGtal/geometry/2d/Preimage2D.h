@@ -41,9 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
-#include <list>
+#include <vector>
 #include "DGtal/base/Common.h"
-#include "DGtal/utils/OpInSTLContainers.h"
 #include "DGtal/geometry/2d/Point2ShapePredicate.h"
 #include "DGtal/io/Color.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -73,6 +72,15 @@ namespace DGtal
    * (if yes - e.g. preimage of straight lines crossing a set of 
    * vertical segments of increasing x-coordinate - this algorithm 
    * will return the right output). 
+   *
+   * The vertices of each part of the preimage are stored in a
+   * ring buffer, since they are only added at the front and removed
+   * at either end: the updates are in amortized O(1) and do not
+   * allocate memory once the buffers are large enough. A preimage
+   * may be computed again with init, reusing its memory, and
+   * greedyPreimages computes the preimages of all the successive
+   * segments of a sequence in one sweep.
+   *
    * @code 
    
    typedef int Coordinate;
@@ -104,6 +112,10 @@ namespace DGtal
      i++;
    }
    std::cout << thePreimage << std::endl;
+
+   // Preimages of the greedy segmentation of the whole sequence
+   std::vector<Preimage2D::Segment> segments;
+   thePreimage.greedyPreimages( bInf.begin(), bInf.end(), bSup.begin(), segments );
    
    * @endcode
    */
@@ -118,16 +130,45 @@ namespace DGtal
 		typedef typename Shape::Coordinate Coordinate;
 		typedef DGtal::PointVector<2,Coordinate> Point;
 		typedef DGtal::PointVector<2,Coordinate> Vector;
+		typedef std::size_t Size;
+
+		/**
+		 * A sequence of consecutive straight segments of non-empty
+		 * preimage, given by the indices of its first segment and after
+		 * its last segment, together with the end points of the two
+		 * critical shapes of its preimage: (pFront,qBack) and (qFront,pBack).
+		 */
+		struct Segment
+		{
+			Size back;
+			Size front;
+			Point pFront, pBack, qFront, qBack;
+		};
 
 	private:
 
-		//container of points
-		typedef std::list<Point> Container;
-		//Iterators on the container
-		typedef typename std::list<Point>::iterator ForwardIterator;
-		typedef typename std::list<Point>::reverse_iterator BackwardIterator;
-		typedef typename std::list<Point>::const_iterator ConstForwardIterator;
-		typedef typename std::list<Point>::const_reverse_iterator ConstBackwardIterator;
+		/**
+		 * Ring buffer of points, whose capacity is a power of two.
+		 * The points are indexed from the front (0) to the back.
+		 */
+		class Container
+		{
+		public:
+			Container() : myFirst( 0 ), mySize( 0 ) {}
+			void clear() { myFirst = 0; mySize = 0; }
+			Size size() const { return mySize; }
+			const Point & operator[]( Size i ) const 
+			{ return myData[ ( myFirst + i ) & ( myData.size() - 1 ) ]; }
+			const Point & front() const { return myData[ myFirst ]; }
+			const Point & back() const { return (*this)[ mySize - 1 ]; }
+			void push_front( const Point & aPoint );
+			void pop_front() 
+			{ myFirst = ( myFirst + 1 ) & ( myData.size() - 1 ); --mySize; }
+			void pop_back() { --mySize; }
+		private:
+			std::vector<Point> myData;
+			Size myFirst, mySize;
+		};
 
 		//Predicates used to decide whether the preimage
     //has to be updated or not
@@ -158,6 +199,14 @@ namespace DGtal
      */
     Preimage2D(const Point & firstPoint, const Point & secondPoint);
 
+    /**
+     * Forgets the current preimage, but not its memory, and 
+     * starts again from a first straight segment.
+     * \param firstPoint, secondPoint, the two end points of 
+     * the first straight segment
+     */
+    void init(const Point & firstPoint, const Point & secondPoint);
+
     /**
      * Destructor. Does nothing.
      */
@@ -170,15 +219,44 @@ namespace DGtal
      * (adding to the front of the sequence of 
      * segments with respect to the scan orientaion
      * e.g. back => seg1 => ... segn => front) 
-		 * Nb: in O(n)
+		 * Nb: in amortized O(1)
      * @param aP, aQ, 
 		 * the two ends of the new straight segment 
 	   * assumed to lie on either side of the shapes. 
-     * @return 'false' if the updated preimage is empty, 
-     * 'true' otherwise.
+     * @return 'false' if the updated preimage is empty
+     * (the preimage is then unchanged), 'true' otherwise.
      */
     bool addFront(const Point & aP, const Point & aQ);
 
+    /**
+     * Splits a sequence of straight segments into the longest 
+     * consecutive segments of non-empty preimage, from the first 
+     * one, and computes their preimages. This object is used as 
+     * workspace and holds the preimage of the last segment at the end.
+     * @param itP, endP, the range of the first end points Pi.
+     * @param itQ, an iterator on the second end points Qi, 
+     * ranging as many points as [itP,endP).
+     * @param segments (returns) the segments, with their preimage.
+     */
+    template <typename PIterator, typename QIterator>
+    void greedyPreimages(PIterator itP, const PIterator & endP, 
+                         QIterator itQ, std::vector<Segment> & segments);
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the last added vertex corresponding to the points Pi.
+    const Point & getPFront() const;
+
+    /// @return the first vertex corresponding to the points Pi.
+    const Point & getPBack() const;
+
+    /// @return the last added vertex corresponding to the points Qi.
+    const Point & getQFront() const;
+
+    /// @return the first vertex corresponding to the points Qi.
+    const Point & getQBack() const;
+
 
     // ----------------------- Interface --------------------------------------
   public:
@@ -237,7 +315,7 @@ private:
     // ------------------------- Private Datas --------------------------------
   private:
 
-		//lists of the vertices of the preimage
+		//vertices of the preimage
     //coorresponding to the points Pi and Qi
 		Container myPHull, myQHull;
 
@@ -253,20 +331,26 @@ private:
   private:
 
     /**
-		 * Updates the current preimage
-		 * Nb: in O(n)
+		 * Updates the current preimage by removing the vertices 
+     * of the front of a container that are not vertices anymore.
+		 * Nb: in amortized O(1)
+     * @param 
+     * aPoint a new vertex of the preimage,
+     * aContainer the container to be updated.
+     */
+		template <typename Predicate>
+    void updateFront(const Point & aPoint, Container & aContainer);
+
+    /**
+		 * Updates the current preimage by removing the vertices 
+     * of the back of a container that are not vertices anymore.
+		 * Nb: in amortized O(1)
      * @param 
      * aPoint a new vertex of the preimage,
-     * aContainer the container to be updated,
-     * anIterator an iterator to its front (resp. back)
-     * anEndIterator an iterator pointing after its back 
-		 * (resp. before its front). 
+     * aContainer the container to be updated.
      */
-		template <typename Iterator, typename Predicate>
-    void update(const Point & aPoint, 
-								Container & aContainer,
-								Iterator & anIterator,
-								const Iterator & anEndIterator);
+		template <typename Predicate>
+    void updateBack(const Point & aPoint, Container & aContainer);
 
 
 
@@ -0,0 +1,288 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file TangentialCover.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/27
+ *
+ * Header file for module TangentialCover.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(TangentialCover_RECURSES)
+#error Recursive header files inclusion detected in TangentialCover.h
+#else // defined(TangentialCover_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define TangentialCover_RECURSES
+
+#if !defined TangentialCover_h
+/** Prevents repeated inclusion of headers. */
+#define TangentialCover_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/geometry/2d/ArithmeticalDSS.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class TangentialCover
+  /**
+     Description of template class 'TangentialCover' <p>
+     \brief Aim: Computes all the maximal DSS of a digital curve (its
+     tangential cover) in one linear pass, and stores them in a flat
+     array of records (back index, front index, a, b, mu).
+
+     Contrary to MaximalSegments, which recomputes each maximal
+     segment from scratch and copies segment computers, a single
+     ArithmeticalDSS is used as a workspace: the next maximal segment
+     is obtained by retracting the back of the current one until its
+     front can be extended, then extending its front as much as
+     possible. Each point is thus added and removed at most once
+     (twice for closed curves).
+
+     For a closed curve, the points are visited circularly; the first
+     point should not be repeated at the end. The segments are sorted
+     by increasing back index, and the front index of a segment
+     crossing the end of the range is smaller than its back index.
+
+     Long curves may be cut into chunks processed in parallel (with
+     OpenMP), giving exactly the same segments: each chunk computes
+     the maximal segments whose back lies in the chunk, starting with
+     the longest DSS beginning at the first point of the chunk (which
+     is dropped if it extends backwards), and extending the last ones
+     across the seam with the next chunk.
+
+     @tparam TIterator a random access iterator on 2D integer points.
+     @tparam TInteger the integer type of the DSS characteristics.
+     @tparam connectivity 4 or 8, as for ArithmeticalDSS.
+
+     @code
+     typedef std::vector<Z2i::Point>::const_iterator ConstIterator;
+     TangentialCover<ConstIterator, int, 4> cover;
+     cover.compute( points.begin(), points.end(), true );
+     for ( unsigned int i = 0; i < cover.size(); ++i )
+       std::cout << cover[ i ].back << " " << cover[ i ].front
+                 << " " << cover[ i ].a << " " << cover[ i ].b << std::endl;
+     @endcode
+  */
+  template <typename TIterator, typename TInteger, int connectivity>
+  class TangentialCover
+  {
+  public:
+    typedef TIterator ConstIterator;
+    typedef TInteger Integer;
+    typedef Circulator<TIterator> ConstCirculator;
+    typedef ArithmeticalDSS<ConstCirculator, TInteger, connectivity> DSS;
+    typedef std::size_t Size;
+
+    /**
+       A maximal segment: the points of indices back, back+1, ...,
+       front (modulo the number of points for closed curves) belong to
+       the DSS of characteristics (a, b, mu), i.e. they satisfy mu <=
+       a.x - b.y < mu + omega.
+    */
+    struct MaximalSegment
+    {
+      /// The index of the first point of the segment.
+      Size back;
+      /// The index of the last point of the segment.
+      Size front;
+      /// The characteristics of the segment.
+      Integer a, b, mu;
+    };
+
+    typedef std::vector<MaximalSegment> Storage;
+    typedef typename Storage::const_iterator SegmentConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~TangentialCover();
+
+    /**
+     * Constructor. The cover is empty.
+     */
+    TangentialCover();
+
+    /**
+       Computes all the maximal segments of the range [itb,ite).
+       Previous segments are forgotten, but memory is reused.
+
+       @param itb begin iterator on the points of the curve.
+       @param ite end iterator on the points of the curve.
+       @param isClosed when 'true', the curve is processed as closed.
+    */
+    void compute( const ConstIterator & itb, const ConstIterator & ite,
+		  bool isClosed );
+
+    /**
+       Computes all the maximal segments of the range [itb,ite), the
+       curve being cut into [nbChunks] chunks processed in parallel
+       when OpenMP is enabled. The segments are the same as the ones
+       of the sequential compute.
+
+       @param itb begin iterator on the points of the curve.
+       @param ite end iterator on the points of the curve.
+       @param isClosed when 'true', the curve is processed as closed.
+       @param nbChunks the number of chunks (1 means sequential).
+    */
+    void compute( const ConstIterator & itb, const ConstIterator & ite,
+		  bool isClosed, Size nbChunks );
+
+    /// @return the number of maximal segments.
+    Size size() const;
+
+    /// @return the number of points of the curve.
+    Size nbPoints() const;
+
+    /// @return 'true' if the curve was processed as closed.
+    bool isClosed() const;
+
+    /**
+       @param i the index of a maximal segment.
+       @return the [i]-th maximal segment.
+    */
+    const MaximalSegment & operator[]( Size i ) const;
+
+    /// @return the maximal segments, sorted by back index.
+    const Storage & segments() const;
+
+    /// @return an iterator on the first maximal segment.
+    SegmentConstIterator begin() const;
+
+    /// @return an iterator after the last maximal segment.
+    SegmentConstIterator end() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The maximal segments.
+    Storage mySegments;
+    /// The segment computer used as a workspace.
+    DSS myDSS;
+    /// The number of points of the curve.
+    Size myNbPoints;
+    /// 'true' if the curve is closed.
+    bool myIsClosed;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    TangentialCover ( const TangentialCover & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    TangentialCover & operator= ( const TangentialCover & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Appends the current segment of a workspace.
+       @param segments the array where the segment is added.
+       @param dss the workspace.
+       @param back the (unrolled) index of its first point.
+       @param front the (unrolled) index of its last point.
+       @param n the number of points of the curve.
+    */
+    static
+    void pushSegment( Storage & segments, const DSS & dss,
+		      long back, long front, long n );
+
+    /**
+       Appends to [segments] the maximal segments of the curve whose
+       back index lies in [start,stop), in increasing order.
+
+       @param segments the array where the segments are added.
+       @param dss the workspace.
+       @param itb begin iterator on the points of the curve.
+       @param ite end iterator on the points of the curve.
+       @param isClosed when 'true', the curve is processed as closed.
+       @param start the first point of the chunk.
+       @param stop the point after the last point of the chunk.
+    */
+    static
+    void computeChunk( Storage & segments, DSS & dss,
+		       const ConstIterator & itb, const ConstIterator & ite,
+		       bool isClosed, long start, long stop );
+
+  }; // end of class TangentialCover
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'TangentialCover'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'TangentialCover' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TIterator, typename TInteger, int connectivity>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const TangentialCover<TIterator, TInteger, connectivity> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/2d/TangentialCover.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined TangentialCover_h
+
+#undef TangentialCover_RECURSES
+#endif // else defined(TangentialCover_RECURSES)
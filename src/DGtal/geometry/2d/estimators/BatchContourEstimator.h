@@ -0,0 +1,263 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchContourEstimator.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/23
+ *
+ * Header file for module BatchContourEstimator.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchContourEstimator_RECURSES)
+#error Recursive header files inclusion detected in BatchContourEstimator.h
+#else // defined(BatchContourEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchContourEstimator_RECURSES
+
+#if !defined BatchContourEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define BatchContourEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchContourEstimator
+  /**
+     Description of template class 'BatchContourEstimator' <p>
+     \brief Aim: Runs a local geometric estimator (like
+     BinomialConvolverEstimator or MostCenteredMaximalSegmentEstimator)
+     on every point of many contours given as Freeman chains.
+
+     Contours are processed concurrently when OpenMP is enabled, each
+     thread having its own array of points and building its own
+     estimator for each contour (so that, e.g., a
+     BinomialConvolverEstimator chooses the mask size of each
+     contour). The values of all the contours are written in one
+     preallocated output array: the values of the i-th contour lie
+     between offset( i ) and offset( i+1 ). Huge files of Freeman
+     chains may also be processed by blocks with evalStream.
+
+     The points of a contour are the ones of
+     FreemanChain::getContourPoints. The last point of a closed
+     contour (equal to its first point) may be removed, as some
+     estimators expect.
+
+     @tparam TEstimator a model of local geometric estimator, default
+     constructible, whose ConstIterator type is the const_iterator of
+     a std::vector of points.
+
+     @code
+     typedef BinomialConvolverEstimator< MyBinomialConvolver, CurvatureBCFct > Estimator;
+     BatchContourEstimator<Estimator> batch( h );
+     batch.init( chains );
+     std::vector<double> curvatures( batch.nbValues() );
+     batch.eval( chains, curvatures.begin() );
+     @endcode
+  */
+  template <typename TEstimator>
+  class BatchContourEstimator
+  {
+  public:
+    typedef TEstimator Estimator;
+    typedef typename Estimator::ConstIterator ConstIterator;
+    typedef typename Estimator::Quantity Quantity;
+    typedef typename ConstIterator::value_type Point;
+    typedef std::vector<Point> Storage;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~BatchContourEstimator();
+
+    /**
+     * Constructor.
+     *
+     * @param h the grid step given to the estimators.
+     * @param removeLastPointIfClosed when 'true', the last point of
+     * closed contours is not given to the estimator.
+     */
+    BatchContourEstimator( double h = 1.0,
+			   bool removeLastPointIfClosed = false );
+
+    /**
+       Computes the number of points, the closedness and the bounding
+       box of each contour, i.e. the layout of the output array.
+
+       @tparam TInteger the integer type of the Freeman chains.
+       @param chains the contours.
+    */
+    template <typename TInteger>
+    void init( const std::vector< FreemanChain<TInteger> > & chains );
+
+    /**
+       Evaluates the estimator on all the points of all the contours.
+       The method init must have been called with the same contours.
+
+       @tparam TInteger the integer type of the Freeman chains.
+       @tparam RandomAccessIterator a random access iterator on Quantity.
+
+       @param chains the contours.
+       @param out the beginning of an array of at least nbValues()
+       elements, where the value of the j-th point of the i-th
+       contour is written at position offset( i ) + j.
+    */
+    template <typename TInteger, typename RandomAccessIterator>
+    void eval( const std::vector< FreemanChain<TInteger> > & chains,
+	       RandomAccessIterator out ) const;
+
+    /**
+       Reads Freeman chains from a stream (one per line, see
+       PointListReader) by blocks of [blockSize] contours, evaluates
+       each block in parallel, and gives the values of each contour,
+       in the order of the stream, to [visitor] as:
+
+       visitor( index, chain, isClosed, itb, ite )
+
+       where [index] is the index of the contour in the stream and
+       [itb,ite) the range of its values. The object is then
+       initialized with the last block.
+
+       @tparam TInteger the integer type of the Freeman chains.
+       @tparam ContourVisitor the type of the visitor.
+
+       @param in the input stream.
+       @param visitor the object receiving the values of each contour.
+       @param blockSize the number of contours processed at once.
+       @return the number of contours read.
+    */
+    template <typename TInteger, typename ContourVisitor>
+    Size evalStream( std::istream & in, ContourVisitor & visitor,
+		     Size blockSize = 1024 );
+
+    /// @return the number of contours given at init.
+    Size nbContours() const;
+
+    /// @return the total number of values of the contours.
+    Size nbValues() const;
+
+    /**
+       @param i any contour index (or nbContours()).
+       @return the index of the first value of the [i]-th contour.
+    */
+    Size offset( Size i ) const;
+
+    /**
+       @param i any contour index.
+       @return 'true' if the [i]-th contour is closed.
+    */
+    bool isClosed( Size i ) const;
+
+    /**
+       @param i any contour index.
+       @return the lowest point of the bounding box of the [i]-th contour.
+    */
+    const Point & lowerBound( Size i ) const;
+
+    /**
+       @param i any contour index.
+       @return the uppermost point of the bounding box of the [i]-th contour.
+    */
+    const Point & upperBound( Size i ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The grid step.
+    double myH;
+    /// When 'true', the last point of closed contours is removed.
+    bool myRemoveLastPointIfClosed;
+    /// The offsets of the values of each contour (size nbContours()+1).
+    std::vector<Size> myOffsets;
+    /// The closedness of each contour.
+    std::vector<char> myClosed;
+    /// The lowest point of the bounding box of each contour.
+    std::vector<Point> myLowerBounds;
+    /// The uppermost point of the bounding box of each contour.
+    std::vector<Point> myUpperBounds;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Computes the points of [chain] in [points] and evaluates a new
+       estimator on them.
+    */
+    template <typename TInteger, typename RandomAccessIterator>
+    void evalContour( Storage & points,
+		      const FreemanChain<TInteger> & chain, bool closed,
+		      RandomAccessIterator out ) const;
+
+  }; // end of class BatchContourEstimator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BatchContourEstimator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BatchContourEstimator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TEstimator>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchContourEstimator<TEstimator> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/2d/estimators/BatchContourEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchContourEstimator_h
+
+#undef BatchContourEstimator_RECURSES
+#endif // else defined(BatchContourEstimator_RECURSES)
@@ -132,8 +132,8 @@ namespace DGtal
     ///Grid size.
     double myH;
 
-    ///polygonal representation of the input
-    std::vector<Point> myRep;
+    ///faithful polygon of the input, computed again by init()
+    FaithfulPolygon myFP;
 
     ///Boolean to make sure that init() has been called before eval().
     bool myIsInitBefore;
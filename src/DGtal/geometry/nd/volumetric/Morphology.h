@@ -0,0 +1,407 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file Morphology.h
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/09/05
+ *
+ * Header file for module Morphology.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(Morphology_RECURSES)
+#error Recursive header files inclusion detected in Morphology.h
+#else // defined(Morphology_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Morphology_RECURSES
+
+#if !defined Morphology_h
+/** Prevents repeated inclusion of headers. */
+#define Morphology_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/nd/volumetric/DistanceTransformation.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class Morphology
+  /**
+   * Description of template class 'Morphology' <p>
+   * \brief Aim: Binary mathematical morphology (dilation, erosion,
+   * opening and closing) of digital sets and digital objects.
+   *
+   * Three kinds of structuring elements are provided:
+   *
+   * - Ball: the euclidean ball {v, |v|_2 <= r}. Operators are computed
+   *   by thresholding the separable DistanceTransformation, hence in
+   *   O(d.N) whatever the radius (N being the number of points of the
+   *   bounding box of the result).
+   *
+   * - Box: the box [-h_0,h_0]x...x[-h_{d-1},h_{d-1}]. It is decomposed
+   *   into d segments, each one processed with the van Herk/Gil-Werman
+   *   algorithm (3 min/max per point and per dimension, whatever the
+   *   half-widths). Lines are processed in parallel when DGtal is
+   *   built WITH_OPENMP.
+   *
+   * - Pattern: any finite set of vectors. The cost is O(|X|.|B|) and
+   *   should be kept for small structuring elements.
+   *
+   * All operators work on a binary image over the bounding box of the
+   * input set, enlarged by the extent of the structuring element, so
+   * that the result is not truncated. Opening and closing are computed
+   * in a single image, before being clipped to the domain of the
+   * output set.
+   *
+   * @tparam TDigitalSet the type of digital set (a model of
+   * CDigitalSet whose domain is an HyperRectDomain).
+   *
+   * @code
+   * typedef Morphology<DigitalSet> Morpho;
+   * DigitalSet closed( domain );
+   * Morpho::closing( closed, set, Morpho::Ball( 30 ) );
+   * Morpho::opening( closed, closed, Morpho::Box( Vector( 2, 2, 1 ) ) );
+   * @endcode
+   *
+   * @see testMorphology.cpp
+   */
+  template <typename TDigitalSet>
+  class Morphology
+  {
+    // ----------------------- public types ------------------------------
+  public:
+    typedef TDigitalSet DigitalSet;
+    typedef typename DigitalSet::Domain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Size Size;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Dimension Dimension;
+    typedef HyperRectDomain<Space> GridDomain;
+    /// Binary image used for the computations (0 means background).
+    typedef ImageContainerBySTLVector<GridDomain, unsigned char> BinaryImage;
+
+    /**
+     * The euclidean ball of radius [radius], i.e. the set of vectors
+     * v such that |v|_2 <= radius.
+     */
+    struct Ball
+    {
+      Ball( double aRadius ) : radius( aRadius ) {}
+      /// @return the half-width of the ball along each axis.
+      Vector extent() const;
+      double radius;
+    };
+
+    /**
+     * The axis-aligned box of half-widths [halfWidths], i.e. the set
+     * of vectors v such that |v_k| <= halfWidths[k] for each k.
+     */
+    struct Box
+    {
+      Box( const Vector & aHalfWidths ) : halfWidths( aHalfWidths ) {}
+      /// @return the half-width of the box along each axis.
+      Vector extent() const { return halfWidths; }
+      Vector halfWidths;
+    };
+
+    /**
+     * Any finite set of vectors.
+     */
+    struct Pattern
+    {
+      Pattern() {}
+      template <typename VectorInputIterator>
+      Pattern( VectorInputIterator b, VectorInputIterator e )
+	: vectors( b, e ) {}
+      /// @return the maximal absolute coordinates along each axis.
+      Vector extent() const;
+      std::vector<Vector> vectors;
+    };
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Dilation of [aSet] by the structuring element [aSE]. The result
+     * is clipped to the domain of [aResult], whose previous content is
+     * lost. [aResult] and [aSet] may be the same set.
+     *
+     * @tparam TStructuringElement either Ball, Box or Pattern.
+     * @param aResult (modified) the set containing the result.
+     * @param aSet the input set.
+     * @param aSE the structuring element.
+     */
+    template <typename TStructuringElement>
+    static void dilation( DigitalSet & aResult, const DigitalSet & aSet,
+			  const TStructuringElement & aSE );
+
+    /**
+     * Erosion of [aSet] by the structuring element [aSE]. Points
+     * outside [aSet] are background. The result is clipped to the
+     * domain of [aResult], whose previous content is lost. [aResult]
+     * and [aSet] may be the same set.
+     *
+     * @tparam TStructuringElement either Ball, Box or Pattern.
+     * @param aResult (modified) the set containing the result.
+     * @param aSet the input set.
+     * @param aSE the structuring element.
+     */
+    template <typename TStructuringElement>
+    static void erosion( DigitalSet & aResult, const DigitalSet & aSet,
+			 const TStructuringElement & aSE );
+
+    /**
+     * Opening (erosion then dilation) of [aSet] by the structuring
+     * element [aSE]. The result is clipped to the domain of
+     * [aResult], whose previous content is lost.
+     *
+     * @tparam TStructuringElement either Ball, Box or Pattern.
+     * @param aResult (modified) the set containing the result.
+     * @param aSet the input set.
+     * @param aSE the structuring element.
+     */
+    template <typename TStructuringElement>
+    static void opening( DigitalSet & aResult, const DigitalSet & aSet,
+			 const TStructuringElement & aSE );
+
+    /**
+     * Closing (dilation then erosion) of [aSet] by the structuring
+     * element [aSE]. The intermediate dilation is not clipped. The
+     * result is clipped to the domain of [aResult], whose previous
+     * content is lost.
+     *
+     * @tparam TStructuringElement either Ball, Box or Pattern.
+     * @param aResult (modified) the set containing the result.
+     * @param aSet the input set.
+     * @param aSE the structuring element.
+     */
+    template <typename TStructuringElement>
+    static void closing( DigitalSet & aResult, const DigitalSet & aSet,
+			 const TStructuringElement & aSE );
+
+    /**
+     * Dilation of a digital object. The result has the same topology
+     * and its point set lies in the same domain.
+     *
+     * @tparam TObject any Object whose DigitalSet is TDigitalSet.
+     * @tparam TStructuringElement either Ball, Box or Pattern.
+     * @param anObject the input object.
+     * @param aSE the structuring element.
+     * @return the dilated object.
+     */
+    template <typename TObject, typename TStructuringElement>
+    static TObject dilation( const TObject & anObject,
+			     const TStructuringElement & aSE );
+
+    /**
+     * Erosion of a digital object. The result has the same topology.
+     *
+     * @tparam TObject any Object whose DigitalSet is TDigitalSet.
+     * @tparam TStructuringElement either Ball, Box or Pattern.
+     * @param anObject the input object.
+     * @param aSE the structuring element.
+     * @return the eroded object.
+     */
+    template <typename TObject, typename TStructuringElement>
+    static TObject erosion( const TObject & anObject,
+			    const TStructuringElement & aSE );
+
+    /**
+     * Opening of a digital object. The result has the same topology.
+     *
+     * @tparam TObject any Object whose DigitalSet is TDigitalSet.
+     * @tparam TStructuringElement either Ball, Box or Pattern.
+     * @param anObject the input object.
+     * @param aSE the structuring element.
+     * @return the opened object.
+     */
+    template <typename TObject, typename TStructuringElement>
+    static TObject opening( const TObject & anObject,
+			    const TStructuringElement & aSE );
+
+    /**
+     * Closing of a digital object. The result has the same topology.
+     *
+     * @tparam TObject any Object whose DigitalSet is TDigitalSet.
+     * @tparam TStructuringElement either Ball, Box or Pattern.
+     * @param anObject the input object.
+     * @param aSE the structuring element.
+     * @return the closed object.
+     */
+    template <typename TObject, typename TStructuringElement>
+    static TObject closing( const TObject & anObject,
+			    const TStructuringElement & aSE );
+
+    // ----------------------- Image services ------------------------------
+  public:
+
+    /**
+     * In-place dilation of a binary image by a ball. Points outside
+     * the image are background.
+     *
+     * @param anImage (modified) the binary image.
+     * @param aSE the structuring element.
+     */
+    static void dilate( BinaryImage & anImage, const Ball & aSE );
+
+    /**
+     * In-place erosion of a binary image by a ball. Points outside
+     * the image are background.
+     *
+     * @param anImage (modified) the binary image.
+     * @param aSE the structuring element.
+     */
+    static void erode( BinaryImage & anImage, const Ball & aSE );
+
+    /**
+     * In-place dilation of a binary image by a box (van Herk/Gil-Werman
+     * passes along each axis). Points outside the image are background.
+     *
+     * @param anImage (modified) the binary image.
+     * @param aSE the structuring element.
+     */
+    static void dilate( BinaryImage & anImage, const Box & aSE );
+
+    /**
+     * In-place erosion of a binary image by a box (van Herk/Gil-Werman
+     * passes along each axis). Points outside the image are background.
+     *
+     * @param anImage (modified) the binary image.
+     * @param aSE the structuring element.
+     */
+    static void erode( BinaryImage & anImage, const Box & aSE );
+
+    /**
+     * In-place dilation of a binary image by a pattern. Points outside
+     * the image are background.
+     *
+     * @param anImage (modified) the binary image.
+     * @param aSE the structuring element.
+     */
+    static void dilate( BinaryImage & anImage, const Pattern & aSE );
+
+    /**
+     * In-place erosion of a binary image by a pattern. Points outside
+     * the image are background.
+     *
+     * @param anImage (modified) the binary image.
+     * @param aSE the structuring element.
+     */
+    static void erode( BinaryImage & anImage, const Pattern & aSE );
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    Morphology();
+
+  private:
+
+    /**
+     * Builds the binary image of [aSet] over its bounding box enlarged
+     * by [margin] in each direction.
+     *
+     * @param aSet any digital set.
+     * @param margin the enlargement of the bounding box.
+     * @return the binary image.
+     */
+    static BinaryImage makeImage( const DigitalSet & aSet,
+				  const Vector & margin );
+
+    /**
+     * Margin of the image of an erosion. Balls and boxes contain the
+     * origin, so their erosion lies in the input set and one point of
+     * background is enough. The erosion by a pattern may lie up to
+     * the pattern extent outside the input set.
+     *
+     * @param aSE the structuring element.
+     * @return the enlargement of the bounding box of the input set.
+     */
+    static Vector erosionMargin( const Ball & aSE );
+    static Vector erosionMargin( const Box & aSE );
+    static Vector erosionMargin( const Pattern & aSE );
+
+    /**
+     * Replaces the content of [aResult] by the foreground points of
+     * [anImage] lying in the domain of [aResult].
+     *
+     * @param aResult (modified) the set containing the result.
+     * @param anImage the binary image.
+     */
+    static void fillSet( DigitalSet & aResult, const BinaryImage & anImage );
+
+    /**
+     * Dilation (if [isDilation]) or erosion of all the lines of
+     * [anImage] along axis [k] by the segment [-h,h] (van Herk/Gil-Werman).
+     *
+     * @param anImage (modified) the binary image.
+     * @param k the axis.
+     * @param h the half-width of the segment.
+     * @param isDilation 'true' for a dilation, 'false' for an erosion.
+     */
+    static void segmentPass( BinaryImage & anImage, Dimension k,
+			     Integer h, bool isDilation );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    Morphology ( const Morphology & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    Morphology & operator= ( const Morphology & other );
+
+  }; // end of class Morphology
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/nd/volumetric/Morphology.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Morphology_h
+
+#undef Morphology_RECURSES
+#endif // else defined(Morphology_RECURSES)
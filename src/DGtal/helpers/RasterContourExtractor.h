@@ -0,0 +1,260 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RasterContourExtractor.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/19
+ *
+ * Header file for module RasterContourExtractor.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RasterContourExtractor_RECURSES)
+#error Recursive header files inclusion detected in RasterContourExtractor.h
+#else // defined(RasterContourExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RasterContourExtractor_RECURSES
+
+#if !defined RasterContourExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define RasterContourExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RasterContourExtractor
+  /**
+     Description of template class 'RasterContourExtractor' <p>
+     \brief Aim: A utility class for extracting all the contours of a
+     2D shape in one raster scan, suited to huge images.
+
+     It gives the same contours as Surfaces::extractAllPointContours4C
+     (and in the same order), but the shape predicate is evaluated
+     once per pixel, and there is no global set of boundary linels.
+
+     The image is cut into bands of rows, which are processed in
+     parallel when OpenMP is enabled. The predicate values of a band
+     (plus one row on each side) are stored in a small raster. Each
+     oriented boundary linel of the band has a unique successor,
+     given by the 2x2 pixels around its head pointel and the surfel
+     adjacency. The linels of the band are followed in raster order:
+     a path starts at a linel without predecessor in the band and
+     stops when its successor lies in another band (or does not
+     exist), and the remaining linels form the contours inside the
+     band. Paths are coded as Freeman chains. The paths of all the
+     bands are finally stitched along the seams by matching the
+     successor of the last linel of a path with the first linel of
+     another path.
+
+     Contours are traced with the interior of the shape on their left
+     (counterclockwise around shapes, clockwise around holes). As for
+     Surfaces::sMakeBoundary, only the linels between two pixels of
+     the space are boundary linels, hence contours touching the border
+     of the space are open.
+
+     @tparam TKSpace the type of cellular grid space of dimension 2
+     (e.g. a KhalimskySpaceND<2>).
+
+     @code
+     std::vector< FreemanChain<Z2i::Integer> > chains;
+     RasterContourExtractor<Z2i::KSpace>::extractAllFreemanChains
+       ( chains, K, set2dPredicate, SurfelAdjacency<2>( true ) );
+     @endcode
+   */
+  template <typename TKSpace>
+  class RasterContourExtractor
+  {
+    BOOST_STATIC_ASSERT( TKSpace::Point::dimension == 2 );
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+       Extracts all the contours of a shape as sequences of points,
+       exactly as Surfaces::extractAllPointContours4C.
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of the shape. Its operator() must be safe to call
+       concurrently.
+
+       @param aVectPointContour2D (returns) the contours, each one
+       being the sequence of the pointels of its linels (closed
+       contours repeat their first point at the end).
+       @param aKSpace any space of dimension 2.
+       @param pp the predicate describing the inside of the shape.
+       @param aSAdj the surfel adjacency chosen for the tracking.
+       @param bandHeight the number of rows of a band.
+    */
+    template <typename PointPredicate>
+    static
+    void extractAllPointContours4C
+    ( std::vector< std::vector<Point> > & aVectPointContour2D,
+      const KSpace & aKSpace, const PointPredicate & pp,
+      const SurfelAdjacency<2> & aSAdj, Integer bandHeight = 64 );
+
+    /**
+       Extracts all the contours of a shape as Freeman chains. The
+       chain of the i-th contour is the one built from the i-th
+       sequence of points of extractAllPointContours4C.
+
+       @tparam TInteger the integer type of the Freeman chains.
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of the shape. Its operator() must be safe to call
+       concurrently.
+
+       @param aVectChains (returns) the contours as Freeman chains.
+       @param aKSpace any space of dimension 2.
+       @param pp the predicate describing the inside of the shape.
+       @param aSAdj the surfel adjacency chosen for the tracking.
+       @param bandHeight the number of rows of a band.
+    */
+    template <typename TInteger, typename PointPredicate>
+    static
+    void extractAllFreemanChains
+    ( std::vector< FreemanChain<TInteger> > & aVectChains,
+      const KSpace & aKSpace, const PointPredicate & pp,
+      const SurfelAdjacency<2> & aSAdj, Integer bandHeight = 64 );
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    RasterContourExtractor();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    RasterContourExtractor ( const RasterContourExtractor & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    RasterContourExtractor & operator= ( const RasterContourExtractor & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Identifies an oriented linel. Keys are ordered as the
+       corresponding signed cells (see SignedKhalimskyCell::operator<).
+    */
+    typedef DGtal::uint64_t Key;
+
+    /**
+       A path of consecutive linels, i.e. a part of a contour, or a
+       whole contour.
+    */
+    struct Path
+    {
+      /// The key of the first linel.
+      Key first;
+      /// The key of the successor of the last linel, or noKey().
+      Key next;
+      /// The smallest key of the linels of the path.
+      Key min;
+      /// The index of the linel of smallest key in the path.
+      std::size_t minIndex;
+      /// The tail pointel of the first linel.
+      Integer x0, y0;
+      /// The Freeman codes of the linels.
+      std::string codes;
+    };
+
+    /**
+       The pixels of a band of rows and the linels already followed.
+    */
+    struct Band;
+
+    /// @return the key meaning "no linel".
+    static Key noKey();
+
+    /**
+       Computes the closed and open contours of the shape.
+
+       @param contours (returns) the contours, as paths sorted by
+       smallest linel.
+    */
+    template <typename PointPredicate>
+    static
+    void extract( std::vector<Path> & contours,
+		  const KSpace & aKSpace, const PointPredicate & pp,
+		  const SurfelAdjacency<2> & aSAdj, Integer bandHeight );
+
+    /**
+       Follows the paths of the band [band].
+       @param paths (returns) the paths of the band.
+    */
+    static
+    void extractBand( std::vector<Path> & paths, Band & band,
+		      const SurfelAdjacency<2> & aSAdj );
+
+    /**
+       Makes [contour] start after its smallest linel if it is closed.
+    */
+    static
+    void rotate( Path & contour );
+
+  }; // end of class RasterContourExtractor
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/helpers/RasterContourExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RasterContourExtractor_h
+
+#undef RasterContourExtractor_RECURSES
+#endif // else defined(RasterContourExtractor_RECURSES)
@@ -0,0 +1,263 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfaceMeshExtractor.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/15
+ *
+ * Header file for module SurfaceMeshExtractor.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfaceMeshExtractor_RECURSES)
+#error Recursive header files inclusion detected in SurfaceMeshExtractor.h
+#else // defined(SurfaceMeshExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfaceMeshExtractor_RECURSES
+
+#if !defined SurfaceMeshExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define SurfaceMeshExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/topology/KhalimskyCellCoder.h"
+#include "DGtal/topology/CodeHashTable.h"
+#include "DGtal/helpers/Surfaces.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfaceMeshExtractor
+  /**
+     Description of template class 'SurfaceMeshExtractor' <p> \brief
+     Aim: A utility class for converting 3D digital surfaces into
+     indexed triangle meshes with shared vertices.
+
+     Each surfel is a square whose corners are its four pointels,
+     hence it gives two triangles, oriented so that their normal
+     points outside the shape (the side of the indirect incident
+     spel of the surfel). Pointels are shared among surfels through
+     a hash table on their codes (see CodeHashTable), so that
+     each vertex is output once. The vertex of the pointel of
+     Khalimsky coordinates (x,y,z) is ( x/2-1/2, y/2-1/2, z/2-1/2 ),
+     i.e. the corner of the unit cubes centered on digital points.
+
+     The mesh is not stored but sent to a MeshWriter, which must
+     have a type Index and the methods:
+     - Index addVertex( double x, double y, double z ),
+     - void addTriangle( Index i, Index j, Index k ),
+     like MeshStreamWriter. Vertices are always added before the
+     triangles that use them.
+
+     Shapes given by a predicate or an image are processed by batches
+     of layers along the last axis. The bels of a batch are computed
+     in parallel slab by slab (Surfaces::sMakeBoundaryParallel), then
+     meshed, and the pointels that cannot be shared anymore are
+     forgotten. Hence memory depends only on the size of a batch.
+     As for Surfaces::sMakeBoundary, only the bels between two spels
+     of the space are considered, so the shape should not touch the
+     border of the space for the mesh to be closed.
+
+     @tparam TKSpace the type of cellular grid space of dimension 3
+     (e.g. a KhalimskySpaceND<3>).
+
+     @code
+     MeshStreamWriter writer;
+     writer.open( "shape.ply" );
+     SurfaceMeshExtractor<KSpace>::extractFromImage( writer, K, image, 128 );
+     writer.close();
+     @endcode
+   */
+  template <typename TKSpace>
+  class SurfaceMeshExtractor
+  {
+    BOOST_STATIC_ASSERT( TKSpace::Point::dimension == 3 );
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef KhalimskyCellCoder<KSpace> Coder;
+    typedef typename Coder::Code Code;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+       Outputs the mesh of a set of surfels.
+
+       @tparam MeshWriter the type of mesh output (see class description).
+       @tparam SCellConstIterator any model of forward iterator on SCell.
+
+       @param aMesh the mesh output.
+       @param aKSpace any space whose cells fit in a code.
+       @param itB an iterator on the first surfel.
+       @param itE an iterator after the last surfel.
+    */
+    template <typename MeshWriter, typename SCellConstIterator>
+    static
+    void extract( MeshWriter & aMesh, const KSpace & aKSpace,
+		  SCellConstIterator itB, SCellConstIterator itE )
+      throw( DGtal::InputException );
+
+    /**
+       Outputs the mesh of the boundary of a shape given by a
+       predicate, within the space [aKSpace].
+
+       @tparam MeshWriter the type of mesh output (see class description).
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of the shape. Its operator() must be safe to call
+       concurrently.
+
+       @param aMesh the mesh output.
+       @param aKSpace any space whose cells fit in a code.
+       @param pp the predicate describing the inside of the shape.
+       @param nbLayers the number of layers of spels of a batch.
+    */
+    template <typename MeshWriter, typename PointPredicate>
+    static
+    void extractFromPredicate( MeshWriter & aMesh, const KSpace & aKSpace,
+			       const PointPredicate & pp,
+			       Integer nbLayers = 128 )
+      throw( DGtal::InputException );
+
+    /**
+       Outputs the mesh of the boundary of the points of an image
+       whose value is greater than a threshold.
+
+       @tparam MeshWriter the type of mesh output (see class description).
+       @tparam Image a model of CImageContainer whose domain
+       includes the spels of [aKSpace].
+
+       @param aMesh the mesh output.
+       @param aKSpace any space whose cells fit in a code.
+       @param anImage any image.
+       @param aThreshold the points of value greater than
+       [aThreshold] are inside the shape.
+       @param nbLayers the number of layers of spels of a batch.
+    */
+    template <typename MeshWriter, typename Image>
+    static
+    void extractFromImage( MeshWriter & aMesh, const KSpace & aKSpace,
+			   const Image & anImage,
+			   typename Image::Value aThreshold,
+			   Integer nbLayers = 128 )
+      throw( DGtal::InputException );
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    SurfaceMeshExtractor();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    SurfaceMeshExtractor ( const SurfaceMeshExtractor & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    SurfaceMeshExtractor & operator= ( const SurfaceMeshExtractor & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       The predicate "[k]-th Khalimsky coordinate lower than [x]" on
+       the codes of cells.
+    */
+    struct KCoordBelow
+    {
+      const Coder & myCoder;
+      Dimension myK;
+      Integer myX;
+      KCoordBelow( const Coder & aCoder, Dimension k, Integer x )
+	: myCoder( aCoder ), myK( k ), myX( x ) {}
+      bool operator()( Code code ) const
+      { return myCoder.kCoord( code, myK ) < myX; }
+    };
+
+    /**
+       The predicate "value greater than a threshold" on an image.
+    */
+    template <typename Image>
+    struct ThresholdPredicate
+    {
+      typedef typename Image::Point Point;
+      const Image & myImage;
+      typename Image::Value myThreshold;
+      ThresholdPredicate( const Image & anImage,
+			  typename Image::Value aThreshold )
+	: myImage( anImage ), myThreshold( aThreshold ) {}
+      bool operator()( const Point & p ) const
+      { return myImage( p ) > myThreshold; }
+    };
+
+    /**
+       Outputs the two triangles of the surfel [s], and its pointels
+       that are not yet in [aMap].
+    */
+    template <typename MeshWriter>
+    static
+    void addSurfel( MeshWriter & aMesh,
+		    CodeHashTable<Coder, typename MeshWriter::Index> & aMap,
+		    const KSpace & aKSpace, const Coder & aCoder,
+		    const SCell & s );
+
+  }; // end of class SurfaceMeshExtractor
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/helpers/SurfaceMeshExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfaceMeshExtractor_h
+
+#undef SurfaceMeshExtractor_RECURSES
+#endif // else defined(SurfaceMeshExtractor_RECURSES)
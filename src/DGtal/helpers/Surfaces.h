@@ -41,10 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Exceptions.h"
 #include "DGtal/topology/SurfelAdjacency.h"
 #include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/CachedSurfelNeighborhood.h"
+#include "DGtal/topology/KhalimskyCellCoder.h"
+#include "DGtal/topology/SCellHashSet.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -82,6 +86,9 @@ namespace DGtal
     typedef typename KSpace::Cell Cell;
     typedef typename KSpace::SCell SCell;
     typedef typename KSpace::DirIterator DirIterator;
+    /// The default set of surfels, a hash set of cell codes, much
+    /// faster and more compact than std::set<SCell>.
+    typedef SCellHashSet<KSpace> SurfelSet;
 
     // ----------------------- Static services ------------------------------
   public:
@@ -148,7 +155,8 @@ namespace DGtal
        PointPredicate. The algorithms tracks surfels along the
        boundary of the shape.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., SurfelSet or
+       std::set<SCell>).
 
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -176,6 +184,31 @@ namespace DGtal
 			const PointPredicate & pp,
 			const SCell & start_surfel );
 
+    /**
+       Same as above, with the default set of surfels, which is first
+       initialized with the space [K]. This overload is chosen
+       whenever [surface] is a SurfelSet.
+
+       @param surface (modified) the boundary component of [pp] which
+       touches [start_surfel].
+       @param K any space whose cells fit in a code (see KhalimskyCellCoder).
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of CPointPredicate.
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+
+       @throw InputException if the cells of [K] do not fit in a
+       code, use then a std::set<SCell> as [surface].
+    */
+    template <typename PointPredicate>
+    static 
+    void trackBoundary( SurfelSet & surface,
+			const KSpace & K,
+			const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+			const PointPredicate & pp,
+			const SCell & start_surfel )
+      throw (DGtal::InputException);
+
 
     /**
        Creates a vector of signed surfels whose elements represents a
@@ -356,7 +389,8 @@ namespace DGtal
      * orientation of the resulting SCell indicates the exterior
      * orientation according the positive axis.
      *
-     @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+     @tparam SCellSet a model of a set of SCell (e.g., SurfelSet or
+       std::set<SCell>).
      
      @param aVectConnectedSCell (modified) a vector containing for
      each connected components a vector of the set of connected SCells.
@@ -366,6 +400,13 @@ namespace DGtal
      @param forceOrientCellExterior used to change the default Cell orientation in 
             order to get the direction of shape exterior (default =false).
      *
+     * The SCells of each component are sorted by increasing SCell,
+     * and the components are sorted by their first SCell, whatever
+     * the size of [aKSpace].
+     *
+     * @note Uses the union-find extraction below whenever the cells
+     * of [aKSpace] fit in a KhalimskyCellCoder, boundary tracking
+     * otherwise.
      */
     template <typename PointPredicate >
     static 
@@ -375,6 +416,49 @@ namespace DGtal
 				   const PointPredicate & pp,
 				   bool forceOrientCellExterior=false );
 
+    /**
+       Extracts all the connected components of the boundary of the
+       digital shape [pp], as contiguous ranges of a single vector of
+       surfels. Component i is made of the surfels
+       aSurfels[ aComponentStarts[ i ] ] to aSurfels[ aComponentStarts[
+       i+1 ] - 1 ]. Surfels are sorted by increasing code (see
+       KhalimskyCellCoder) within each component, and components are
+       sorted by their first surfel.
+
+       The boundary is extracted with sMakeBoundaryParallel. The
+       components are labelled by a union-find over surfel adjacency.
+       Neighbors are computed in parallel by blocks of surfels and
+       looked up by binary search among the sorted surfel codes. The
+       unions are then done sequentially for the block. Hence no set
+       of cells is ever built.
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape. Its operator() must be safe to
+       call concurrently.
+
+       @param aSurfels (modified) the surfels of all the components.
+       @param aComponentStarts (modified) the index of the first
+       surfel of each component, followed by aSurfels.size().
+       @param aKSpace any space, whose cells fit in a KhalimskyCellCoder.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param pp any digital shape.
+       @param forceOrientCellExterior used to change the default Cell
+       orientation in order to get the direction of shape exterior
+       (default =false).
+
+       @throw InputException if the cells of [aKSpace] do not fit in a
+       KhalimskyCellCoder.
+    */
+    template <typename PointPredicate >
+    static
+    void extractAllConnectedSCell( std::vector<SCell> & aSurfels,
+				   std::vector<std::size_t> & aComponentStarts,
+				   const KSpace & aKSpace,
+				   const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+				   const PointPredicate & pp,
+				   bool forceOrientCellExterior=false )
+      throw (DGtal::InputException);
+
     
     
 
@@ -409,7 +493,8 @@ namespace DGtal
        be fully inside the space. Follows the idea of Artzy, Frieder
        and Herman algorithm [Artzy:1981-cgip], but in nD.
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., SurfelSet or
+       std::set<SCell>).
 
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
@@ -436,6 +521,31 @@ namespace DGtal
 			      const SurfelAdjacency<KSpace::dimension> & surfel_adj,
 			      const PointPredicate & pp,
 			      const SCell & start_surfel );
+
+    /**
+       Same as above, with the default set of surfels, which is first
+       initialized with the space [K]. This overload is chosen
+       whenever [surface] is a SurfelSet.
+
+       @param surface (modified) the boundary component of [pp] which
+       touches [start_surfel].
+       @param K any space whose cells fit in a code (see KhalimskyCellCoder).
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of CPointPredicate.
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+
+       @throw InputException if the cells of [K] do not fit in a
+       code, use then a std::set<SCell> as [surface].
+    */
+    template <typename PointPredicate>
+    static 
+    void trackClosedBoundary( SurfelSet & surface,
+			      const KSpace & K,
+			      const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+			      const PointPredicate & pp,
+			      const SCell & start_surfel )
+      throw (DGtal::InputException);
     
     /**
        Creates a set of unsigned surfels whose elements represents all the
@@ -470,7 +580,8 @@ namespace DGtal
        boundary components of a digital shape described by the predicate
        [pp].
        
-       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam SCellSet a model of a set of SCell (e.g., SurfelSet or
+       std::set<SCell>).
        @tparam PointPredicate a model of CPointPredicate describing
        the inside of a digital shape, meaning a functor taking a Point
        and returning 'true' whenever the point belongs to the shape.
@@ -492,6 +603,57 @@ namespace DGtal
 			const KSpace & aKSpace,
 			const PointPredicate & pp,
 			const Cell aLowerBound, const Cell aUpperBound  );
+
+    /**
+       Parallel version of uMakeBoundary. The box of spels is split
+       into slabs along the last axis, one per thread. Each slab
+       evaluates the predicate once per spel, layer by layer, and
+       collects its surfels in its own vector. The vectors are then
+       concatenated in slab order, so the result does not depend on
+       the number of threads: surfels are sorted by their spel in
+       scanning order, then by direction.
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape. Its operator() must be safe to
+       call concurrently.
+
+       @param aBoundary (modified) the surfels of the boundary are
+       appended to this vector.
+       @param aKSpace any space.
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+       @param aLowerBound and @param aUpperBound the spels giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate >
+    static
+    void uMakeBoundaryParallel( std::vector<Cell> & aBoundary,
+				const KSpace & aKSpace,
+				const PointPredicate & pp,
+				const Cell aLowerBound, const Cell aUpperBound );
+
+    /**
+       Parallel version of sMakeBoundary, see uMakeBoundaryParallel.
+       Surfels are oriented as in sMakeBoundary.
+
+       @tparam PointPredicate a model of CPointPredicate describing
+       the inside of a digital shape. Its operator() must be safe to
+       call concurrently.
+
+       @param aBoundary (modified) the signed surfels of the boundary
+       are appended to this vector.
+       @param aKSpace any space.
+       @param pp an instance of a model of CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+       @param aLowerBound and @param aUpperBound the spels giving the
+       bounds of the extracted boundary.
+    */
+    template <typename PointPredicate >
+    static
+    void sMakeBoundaryParallel( std::vector<SCell> & aBoundary,
+				const KSpace & aKSpace,
+				const PointPredicate & pp,
+				const Cell aLowerBound, const Cell aUpperBound );
     
 
     
@@ -556,6 +718,62 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Computes the boundary surfels of the shape [pp] within the box
+       of spels [aLowerBound,aUpperBound], slab by slab (see
+       uMakeBoundaryParallel), and appends them to [aBoundary].
+
+       @tparam BelCell either Cell or SCell.
+    */
+    template <typename BelCell, typename PointPredicate>
+    static
+    void makeBoundaryBySlabs( std::vector<BelCell> & aBoundary,
+			      const KSpace & aKSpace,
+			      const PointPredicate & pp,
+			      const Cell & aLowerBound,
+			      const Cell & aUpperBound );
+
+    /**
+       Evaluates the predicate [pp] on the layer of spels of last
+       coordinate [z] within [lo,hi], in scanning order.
+    */
+    template <typename PointPredicate>
+    static
+    void evaluateLayer( std::vector<unsigned char> & aLayer,
+			const PointPredicate & pp,
+			const Point & lo, const Point & hi, Integer z );
+
+    /**
+       @return the unsigned surfel between the spel [p] and the spel
+       [p]+e_k.
+    */
+    static Cell makeBel( const KSpace & aKSpace, const Point & p,
+			 Dimension k, bool in_here, const Cell * );
+
+    /**
+       @return the signed surfel between the spel [p] and the spel
+       [p]+e_k, oriented as in sMakeBoundary.
+    */
+    static SCell makeBel( const KSpace & aKSpace, const Point & p,
+			  Dimension k, bool in_here, const SCell * );
+
+    /**
+       Extracts the 2D contours of [pp], using [aVisited] first to
+       compute its boundary, then to mark the tracked surfels.
+       Contours are started from the unvisited surfel that is the
+       smallest for SCell::operator<.
+
+       @tparam SCellSet a model of a set of SCell.
+    */
+    template <typename SCellSet, typename PointPredicate>
+    static
+    void extractAll2DSCellContoursInSet
+    ( std::vector< std::vector<SCell> > & aVectSCellContour2D,
+      SCellSet & aVisited,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp );
+
   }; // end of class Surfaces
 
 
@@ -0,0 +1,432 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedFile.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/10/09
+ *
+ * Header file for module ImageContainerByMappedFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedFile.h
+#else // defined(ImageContainerByMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedFile_RECURSES
+
+#if !defined ImageContainerByMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/images/CValue.h"
+#include "DGtal/kernel/domains/CBoundedDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMappedFile
+  /**
+   * Description of template class 'ImageContainerByMappedFile' <p>
+   * \brief Aim: an image container whose values are the ones of a
+   * "Raw", "Vol" or "Longvol" file, mapped in memory.
+   *
+   * Opening an image only reads the header of the file and maps the
+   * file in memory: the values are read by the system when they are
+   * accessed, so that only the pages of the file containing the
+   * accessed values are loaded. The file is never modified: the
+   * mapping is private, so that setValue only changes the copy of
+   * the page in memory. On systems without mmap (WIN32), the file is
+   * read in memory when it is opened.
+   *
+   * The values are stored contiguously, the first coordinate first,
+   * as in ImageContainerBySTLVector. Vol files contain 8-bit values
+   * and Longvol files 64-bit little endian values, so that Value
+   * must be a type of the same size. For raw files, the byte order
+   * of the file is given when opening it. When it is not the one of
+   * the computer, the values are swapped when accessed by operator()
+   * and setValue, but not by the iterators.
+   *
+   * @code
+   * typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> Image;
+   * Image image;
+   * image.openVol( "Al.100.vol" );
+   * ImageContainerBySTLVector<Z3i::Domain, unsigned char> box
+   *   = image.extract( Z3i::Point( 10, 10, 10 ), Z3i::Point( 20, 20, 20 ) );
+   * @endcode
+   *
+   * @tparam TDomain the domain of the image, a model of CBoundedDomain.
+   * @tparam TValue the type of the values of the image.
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedFile
+  {
+  public:
+
+    BOOST_CONCEPT_ASSERT(( CValue<TValue> ));
+    BOOST_CONCEPT_ASSERT(( CBoundedDomain<TDomain> ));
+
+    typedef TValue Value;
+    typedef TDomain Domain;
+
+    // static constants
+    static const typename Domain::Dimension dimension = Domain::dimension;
+
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Dimension Dimension;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+
+    typedef Value* Iterator;
+    typedef const Value* ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The image is empty until a file is opened.
+     */
+    ImageContainerByMappedFile();
+
+    /**
+     * Destructor. Unmaps the file.
+     */
+    ~ImageContainerByMappedFile();
+
+    /**
+     * Maps a raw file.
+     * @param filename the file name.
+     * @param aPointA, aPointB the bounds of the image.
+     * @param anOffset the number of bytes before the values.
+     * @param isBigEndian 'true' if the bytes of the values are
+     * stored from the most significant one, 'false' otherwise.
+     */
+    void openRaw( const std::string & filename,
+		  const Point & aPointA, const Point & aPointB,
+		  Size anOffset = 0, bool isBigEndian = false )
+      throw( DGtal::IOException );
+
+    /**
+     * Maps the values of a Vol file (3D, 8-bit values).
+     * @param filename the file name.
+     */
+    void openVol( const std::string & filename ) throw( DGtal::IOException );
+
+    /**
+     * Maps the values of a Longvol file (3D, 64-bit values).
+     * @param filename the file name.
+     */
+    void openLongvol( const std::string & filename ) throw( DGtal::IOException );
+
+    /**
+     * Unmaps the file. The image is then empty.
+     */
+    void close();
+
+    /// @return 'true' if a file is mapped.
+    bool isOpen() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the value at [aPoint].
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * @param it an iterator on the values.
+     * @return the value at [it].
+     */
+    Value operator()( ConstIterator & it ) const;
+
+    /**
+     * @param it an iterator on the values.
+     * @return the value at [it].
+     */
+    Value operator()( Iterator & it ) const;
+
+    /**
+     * Sets a value in memory, the file being unchanged.
+     * @param aPoint a point of the domain.
+     * @param aValue the new value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * Sets a value in memory, the file being unchanged.
+     * @param it an iterator on the values.
+     * @param aValue the new value.
+     */
+    void setValue( Iterator & it, const Value & aValue );
+
+    /// @return an iterator on the first value.
+    Iterator begin();
+    /// @return an iterator after the last value.
+    Iterator end();
+    /// @return an iterator on the first value.
+    ConstIterator begin() const;
+    /// @return an iterator after the last value.
+    ConstIterator end() const;
+
+    /// @return the number of values.
+    Size size() const;
+
+    /// @return the extent of the image.
+    Vector extent() const;
+
+    /// @return the lower bound of the image.
+    Point lowerBound() const;
+
+    /// @return the upper bound of the image.
+    Point upperBound() const;
+
+    /// @return the domain of the image.
+    Domain domain() const;
+
+    /**
+     * Copies the values of a box of the image. Only the pages
+     * containing the box are read.
+     * @param aPointA, aPointB the bounds of the box, in the domain.
+     * @return an image of the values of the box.
+     */
+    ImageContainerBySTLVector<Domain,Value>
+    extract( const Point & aPointA, const Point & aPointB ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /////////////////////////// Custom Iterators ////////////////////:
+    /**
+     * Read-only span iterator, as the ones of ImageContainerBySTLVector.
+     */
+    class SpanIterator
+    {
+      friend class ImageContainerByMappedFile<Domain, Value>;
+
+    public:
+      typedef std::bidirectional_iterator_tag iterator_category;
+      typedef Value value_type;
+      typedef ptrdiff_t difference_type;
+      typedef const Value* pointer;
+      typedef Value reference;
+
+      SpanIterator( const Point & p ,
+		    const Dimension aDim ,
+		    const ImageContainerByMappedFile<Domain, Value> *aMap )
+	: myMap( aMap ), myDimension( aDim )
+      {
+	myPos = aMap->linearized( p );
+	myShift = 1;
+	for ( unsigned int k = 0; k < myDimension; k++ )
+	  myShift *= ( aMap->myUpperBound.at( k ) - aMap->myLowerBound.at( k ) + 1 );
+      }
+
+      inline
+      Value operator*() const
+      {
+	return myMap->get( myPos );
+      }
+
+      inline
+      bool operator== ( const SpanIterator &it ) const
+      {
+	return ( myPos == it.myPos );
+      }
+
+      inline
+      bool operator!= ( const SpanIterator &it ) const
+      {
+	return ( myPos != it.myPos );
+      }
+
+      inline
+      SpanIterator &operator++()
+      {
+	myPos += myShift;
+	return *this;
+      }
+
+      inline
+      SpanIterator &operator--()
+      {
+	myPos -= myShift;
+	return *this;
+      }
+
+    private:
+      ///Current position in the values
+      Size myPos;
+      ///The image
+      const ImageContainerByMappedFile<Domain, Value> *myMap;
+      ///Dimension on which the iterator must iterate
+      Dimension myDimension;
+      ///Padding variable
+      Size myShift;
+    };
+
+    /**
+     * @param aPoint the starting point of the SpanIterator.
+     * @param aDimension the dimension on which the iterator iterates.
+     * @return a begin() SpanIterator.
+     */
+    SpanIterator spanBegin( const Point & aPoint, const Dimension aDimension ) const;
+
+    /**
+     * @param aPoint a point of the span.
+     * @param aDimension the dimension on which the iterator iterates.
+     * @return an end() SpanIterator.
+     */
+    SpanIterator spanEnd( const Point & aPoint, const Dimension aDimension ) const;
+
+    /**
+     * @param it position given by a SpanIterator.
+     * @return the value at [it].
+     */
+    Value operator()( const SpanIterator & it ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The bounds of the image.
+    Point myLowerBound, myUpperBound;
+    /// The first byte of the values, or 0 if no file is mapped.
+    char * myData;
+    /// The beginning and the size of the mapping.
+    void * myMapping;
+    std::size_t myMappingSize;
+    /// The file, when it cannot be mapped.
+    std::vector<char> myBuffer;
+    /// 'true' if the bytes of the values must be reversed.
+    bool mySwap;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ImageContainerByMappedFile ( const ImageContainerByMappedFile & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ImageContainerByMappedFile & operator= ( const ImageContainerByMappedFile & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of its value.
+     */
+    Size linearized( const Point & aPoint ) const;
+
+    /**
+     * @param i the index of a value.
+     * @return the value, in the byte order of the computer.
+     */
+    Value get( Size i ) const;
+
+    /**
+     * @param i the index of a value.
+     * @param aValue the value, in the byte order of the computer.
+     */
+    void set( Size i, const Value & aValue );
+
+    /**
+     * Reverses the bytes of a value if needed.
+     * @param aValue a value.
+     * @return the value in the other byte order if mySwap is 'true'.
+     */
+    Value swap( const Value & aValue ) const;
+
+    /**
+     * Reads the header of a Vol or Longvol file.
+     * @param filename the file name.
+     * @param aPoint (returns) the upper bound of the image.
+     * @return the number of bytes before the values.
+     */
+    static Size readVolHeader( const std::string & filename, Point & aPoint )
+      throw( DGtal::IOException );
+
+    /**
+     * Maps the file and checks its size.
+     * @param filename the file name.
+     * @param anOffset the number of bytes before the values.
+     */
+    void map( const std::string & filename, Size anOffset )
+      throw( DGtal::IOException );
+
+  }; // end of class ImageContainerByMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const ImageContainerByMappedFile<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMappedFile.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedFile_h
+
+#undef ImageContainerByMappedFile_RECURSES
+#endif // else defined(ImageContainerByMappedFile_RECURSES)
@@ -160,6 +160,24 @@ public:
   template < typename TInteger > 
   static std::vector< FreemanChain< TInteger > > getFreemanChainsFromFile (const std::string &filename);
   
+
+  /** 
+   * Reads at most [nb] FreemanChain contours from an input stream,
+   * each line representing a FreemanChain, so that huge files may be
+   * processed chunk by chunk.
+   * 
+   * @param in the input stream.
+   * @param aVectChains (modified) the read FreemanChain are appended to it.
+   * @param nb the maximal number of FreemanChain to read.
+   
+   * @return the number of FreemanChain read, less than [nb] only
+   * when the end of the stream is reached.
+   **/
+  template < typename TInteger > 
+  static unsigned int getFreemanChainsFromInputStream
+  ( std::istream &in, std::vector< FreemanChain< TInteger > > & aVectChains, 
+    unsigned int nb );
+  
   
   
 
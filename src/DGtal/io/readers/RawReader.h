@@ -44,7 +44,9 @@
 #include <string>
 #include <cstdio>
 #include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -54,10 +56,20 @@ namespace DGtal
   // template class RawReader
   /**
    * Description of template class 'RawReader' <p>
-   * \brief Aim: implements methods to read a "Vol" file format.
+   * \brief Aim: implements methods to read a "Raw" file format.
    *
-   * The main import method "importRaw8" returns an instance of the template 
-   * parameter TImageContainer.
+   * The main import methods "importRaw8" and "importRaw" return an 
+   * instance of the template parameter TImageContainer. The raw 
+   * file contains the values of the image, scanned as the domain 
+   * (first coordinate first), stored as 8 bits (importRaw8) or as 
+   * words of any type, e.g. 16/32-bit integers or floats (importRaw),
+   * with any byte order.
+   *
+   * The file is read by large blocks. When the image is an 
+   * ImageContainerBySTLVector, the values are read directly in its
+   * storage when their type is the one of the words of the file,
+   * and otherwise converted block by block. The file may then be
+   * read by several threads, each one reading its own chunk.
    *
    * Example usage:
    * @code
@@ -72,6 +84,9 @@ namespace DGtal
    * RawReader<Image> reader;
    * Image image = reader.importRaw8("data.raw");
    *
+   * //16-bit big endian data, read by 4 threads
+   * Image image16 = reader.importRaw<unsigned short>("data16.raw", extent, true, 4);
+   *
    * trace.info() << image <<endl;
    * ...
    * @endcode
@@ -88,6 +103,8 @@ namespace DGtal
 
     typedef TImageContainer ImageContainer;
     typedef typename TImageContainer::Domain::Vector Vector;
+    typedef typename TImageContainer::Value Value;
+    typedef std::size_t Size;
 
     BOOST_STATIC_ASSERT( (ImageContainer::Domain::dimension == 2) || 
 			 (ImageContainer::Domain::dimension == 3));
@@ -103,6 +120,107 @@ namespace DGtal
      */
     static ImageContainer importRaw8(const std::string & filename,
 				     const Vector & extent) throw(DGtal::IOException);
+
+    /** 
+     * Imports a Raw file of words of type Word (e.g. unsigned
+     * short, unsigned int, float) into an instance of the template
+     * parameter ImageContainer.
+     * 
+     * @param filename the file name to import.
+     * @param extent the size of the raw data set.
+     * @param isBigEndian 'true' if the bytes of the words are
+     * stored from the most significant one, 'false' otherwise.
+     * @param nbChunks the number of chunks of the file, read in
+     * parallel when OpenMP is enabled and the image is an
+     * ImageContainerBySTLVector.
+     * @return an instance of the ImageContainer.
+     *
+     * @tparam Word the type of the values in the file.
+     */
+    template <typename Word>
+    static ImageContainer importRaw(const std::string & filename,
+				    const Vector & extent,
+				    bool isBigEndian = false,
+				    unsigned int nbChunks = 1) throw(DGtal::IOException);
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// The number of words read at once when they are converted.
+    static const Size BLOCK_SIZE = 65536;
+
+    /**
+     * @return 'true' if the words of this computer are stored from
+     * their most significant byte.
+     */
+    static bool isHostBigEndian();
+
+    /**
+     * Reverses the bytes of each word of an array.
+     * @param data the array.
+     * @param n the number of words.
+     */
+    template <typename Word>
+    static void swapBytes(Word * data, Size n);
+
+    /**
+     * Moves the position of a file with a 64-bit offset, so that
+     * files larger than 2GB may be read by chunks.
+     * @param fin the file.
+     * @param offset the offset in bytes from the beginning of the file.
+     * @return 'true' if the position was set.
+     */
+    static bool seek(FILE * fin, Size offset);
+
+    /**
+     * Reads the words of a file into any image, following its domain.
+     * @param filename the file name to import.
+     * @param domain the domain of the image.
+     * @param size the number of words.
+     * @param swap 'true' if the bytes of the words must be reversed.
+     * @param nbChunks not used.
+     * @param image (returns) the image.
+     * @return 'true' if the [size] words were read.
+     */
+    template <typename Word, typename TImage>
+    static bool readValues(const std::string & filename, 
+			   const typename TImage::Domain & domain, Size size, 
+			   bool swap, unsigned int nbChunks, TImage & image);
+
+    /**
+     * Reads the words of a file into the storage of an
+     * ImageContainerBySTLVector, by [nbChunks] chunks.
+     * @param filename the file name to import.
+     * @param domain not used.
+     * @param size the number of words.
+     * @param swap 'true' if the bytes of the words must be reversed.
+     * @param nbChunks the number of chunks.
+     * @param image (returns) the image.
+     * @return 'true' if the [size] words were read.
+     */
+    template <typename Word, typename TDomain, typename TValue>
+    static bool readValues(const std::string & filename, 
+			   const TDomain & domain, Size size, 
+			   bool swap, unsigned int nbChunks,
+			   ImageContainerBySTLVector<TDomain,TValue> & image);
+
+    /**
+     * Reads the words [begin,end) of a file directly at the
+     * position [out] of a contiguous array of values of type Word.
+     * @return 'true' if the words were read.
+     */
+    template <typename Word, typename OutputIterator>
+    static bool readChunk(const std::string & filename, Size begin, Size end,
+			  bool swap, OutputIterator out, boost::true_type);
+
+    /**
+     * Reads the words [begin,end) of a file by blocks and converts
+     * them to the values written at the position [out].
+     * @return 'true' if the words were read.
+     */
+    template <typename Word, typename OutputIterator>
+    static bool readChunk(const std::string & filename, Size begin, Size end,
+			  bool swap, OutputIterator out, boost::false_type);
     
   }; // end of class RawReader
 
@@ -0,0 +1,220 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file MeshStreamWriter.cpp
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/15
+ *
+ * Implementation of methods defined in MeshStreamWriter.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cctype>
+#include <cstring>
+#include <iomanip>
+#include "DGtal/io/writers/MeshStreamWriter.h"
+// Includes inline functions/methods if necessary.
+#if !defined(INLINE)
+#include "DGtal/io/writers/MeshStreamWriter.ih"
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+///////////////////////////////////////////////////////////////////////////////
+// class MeshStreamWriter
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+DGtal::MeshStreamWriter::~MeshStreamWriter()
+{
+  if ( isOpen() )
+    {
+      try { close(); }
+      catch ( ... ) {}
+    }
+}
+
+void
+DGtal::MeshStreamWriter::open( const std::string & filename, Format format )
+  throw( DGtal::IOException )
+{
+  if ( isOpen() ) close();
+  myFormat = format;
+  myNbVertices = 0;
+  myNbTriangles = 0;
+  myOut.open( filename.c_str(), ios::out | ios::binary | ios::trunc );
+  if ( ! myOut.good() )
+    {
+      trace.error() << "[MeshStreamWriter::open] Unable to open "
+		    << filename << std::endl;
+      throw IOException();
+    }
+  myFaces = std::tmpfile();
+  if ( myFaces == 0 )
+    {
+      myOut.close();
+      trace.error() << "[MeshStreamWriter::open] Unable to create a"
+		    << " temporary file." << std::endl;
+      throw IOException();
+    }
+  writeHeader();
+}
+
+void
+DGtal::MeshStreamWriter::open( const std::string & filename )
+  throw( DGtal::IOException )
+{
+  std::string ext = filename.size() >= 4
+    ? filename.substr( filename.size() - 4 ) : std::string();
+  for ( std::string::iterator it = ext.begin(); it != ext.end(); ++it )
+    *it = tolower( *it );
+  if ( ext == ".ply" )      open( filename, PLY );
+  else if ( ext == ".off" ) open( filename, OFF );
+  else
+    {
+      trace.error() << "[MeshStreamWriter::open] Unknown mesh format for "
+		    << filename << std::endl;
+      throw IOException();
+    }
+}
+
+void
+DGtal::MeshStreamWriter::close() throw( DGtal::IOException )
+{
+  if ( ! isOpen() ) return;
+  // Appends the faces after the vertices.
+  std::rewind( myFaces );
+  char buffer[ 65536 ];
+  std::size_t n;
+  while ( ( n = std::fread( buffer, 1, sizeof( buffer ), myFaces ) ) > 0 )
+    myOut.write( buffer, n );
+  bool ok = ! std::ferror( myFaces );
+  std::fclose( myFaces );
+  myFaces = 0;
+  // Rewrites the header with the final counts.
+  myOut.seekp( 0 );
+  writeHeader();
+  ok = ok && myOut.good();
+  myOut.close();
+  if ( ! ok )
+    {
+      trace.error() << "[MeshStreamWriter::close] IO error." << std::endl;
+      throw IOException();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Mesh services - public :
+
+DGtal::MeshStreamWriter::Index
+DGtal::MeshStreamWriter::addVertex( double x, double y, double z )
+{
+  ASSERT( isOpen() );
+  char buffer[ 12 ];
+  char* p = put( buffer, (float) x );
+  p = put( p, (float) y );
+  put( p, (float) z );
+  myOut.write( buffer, 12 );
+  return myNbVertices++;
+}
+
+void
+DGtal::MeshStreamWriter::addTriangle( Index i, Index j, Index k )
+{
+  ASSERT( isOpen() );
+  char buffer[ 20 ];
+  char* p = buffer;
+  if ( myFormat == PLY )
+    *p++ = 3;
+  else
+    p = put( p, (DGtal::uint32_t) 3 );
+  p = put( p, i );
+  p = put( p, j );
+  p = put( p, k );
+  if ( myFormat == OFF )
+    p = put( p, (DGtal::uint32_t) 0 ); // no color
+  std::fwrite( buffer, 1, p - buffer, myFaces );
+  ++myNbTriangles;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Interface - public :
+
+void
+DGtal::MeshStreamWriter::selfDisplay ( std::ostream & out ) const
+{
+  out << "[MeshStreamWriter " << ( myFormat == PLY ? "PLY" : "OFF" )
+      << " vertices=" << myNbVertices
+      << " triangles=" << myNbTriangles << "]";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Internals - private :
+
+void
+DGtal::MeshStreamWriter::writeHeader()
+{
+  if ( myFormat == PLY )
+    {
+      myOut << "ply" << "\n"
+	    << "format binary_little_endian 1.0" << "\n"
+	    << "comment DGtal mesh" << "\n"
+	    << "element vertex " << std::setw( 10 ) << myNbVertices << "\n"
+	    << "property float x" << "\n"
+	    << "property float y" << "\n"
+	    << "property float z" << "\n"
+	    << "element face " << std::setw( 10 ) << myNbTriangles << "\n"
+	    << "property list uchar int vertex_indices" << "\n"
+	    << "end_header" << "\n";
+    }
+  else
+    {
+      char buffer[ 12 ];
+      char* p = put( buffer, myNbVertices );
+      p = put( p, myNbTriangles );
+      put( p, (DGtal::uint32_t) 0 ); // number of edges
+      myOut << "OFF BINARY" << "\n";
+      myOut.write( buffer, 12 );
+    }
+}
+
+char*
+DGtal::MeshStreamWriter::put( char* buffer, DGtal::uint32_t v ) const
+{
+  // PLY is written little-endian, binary OFF is big-endian.
+  for ( int i = 0; i < 4; ++i )
+    buffer[ myFormat == PLY ? i : 3 - i ] = (char) ( ( v >> ( 8 * i ) ) & 0xff );
+  return buffer + 4;
+}
+
+char*
+DGtal::MeshStreamWriter::put( char* buffer, float v ) const
+{
+  DGtal::uint32_t bits;
+  std::memcpy( &bits, &v, 4 );
+  return put( buffer, bits );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
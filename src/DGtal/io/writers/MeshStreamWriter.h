@@ -0,0 +1,245 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MeshStreamWriter.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/15
+ *
+ * Header file for module MeshStreamWriter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MeshStreamWriter_RECURSES)
+#error Recursive header files inclusion detected in MeshStreamWriter.h
+#else // defined(MeshStreamWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MeshStreamWriter_RECURSES
+
+#if !defined MeshStreamWriter_h
+/** Prevents repeated inclusion of headers. */
+#define MeshStreamWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class MeshStreamWriter
+  /**
+   * Description of class 'MeshStreamWriter' <p>
+   * \brief Aim: Writes an indexed triangle mesh in binary PLY or OFF
+   * format, as its vertices and triangles are produced.
+   *
+   * Vertices are written directly to the file. Since both formats
+   * store all the vertices before the faces, triangles are written
+   * to a temporary file and appended at the end. The numbers of
+   * vertices and faces are written in the header when the mesh is
+   * closed. Hence the mesh is never held in memory.
+   *
+   * - PLY: "binary_little_endian 1.0", float vertex coordinates and
+   *   faces as a uchar count followed by int indices.
+   * - OFF: the binary variant of Geomview ("OFF BINARY"), big-endian
+   *   int counts, float coordinates, and each face as int count,
+   *   int indices and a null int color count.
+   *
+   * It is a model of the mesh output expected by SurfaceMeshExtractor.
+   *
+   * @code
+   * MeshStreamWriter writer;
+   * writer.open( "surface.ply" );
+   * MeshStreamWriter::Index i = writer.addVertex( 0.0, 0.0, 0.0 );
+   * ...
+   * writer.addTriangle( i, j, k );
+   * writer.close();
+   * @endcode
+   */
+  class MeshStreamWriter
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    /// The supported file formats.
+    enum Format { PLY, OFF };
+    /// The type of vertex indices.
+    typedef DGtal::uint32_t Index;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor. Closes the mesh if it is still open.
+     */
+    ~MeshStreamWriter();
+
+    /**
+     * Constructor. No file is open.
+     */
+    MeshStreamWriter();
+
+    /**
+     * Opens a new mesh file and writes a temporary header.
+     *
+     * @param filename the name of the output file.
+     * @param format the file format.
+     */
+    void open( const std::string & filename, Format format )
+      throw( DGtal::IOException );
+
+    /**
+     * Opens a new mesh file, whose format is given by the extension
+     * of [filename] (".ply" or ".off").
+     *
+     * @param filename the name of the output file.
+     */
+    void open( const std::string & filename )
+      throw( DGtal::IOException );
+
+    /**
+     * Writes the triangles and the final header, then closes the file.
+     */
+    void close() throw( DGtal::IOException );
+
+    /// @return 'true' iff a mesh file is open.
+    bool isOpen() const;
+
+    // ----------------------- Mesh services ----------------------------------
+  public:
+
+    /**
+     * Writes a vertex.
+     * @param x,y,z its coordinates.
+     * @return its index, the number of vertices written before.
+     */
+    Index addVertex( double x, double y, double z );
+
+    /**
+     * Writes a triangle. Its vertices need not be written yet.
+     * @param i,j,k the indices of its vertices (counterclockwise
+     * when seen from the outside).
+     */
+    void addTriangle( Index i, Index j, Index k );
+
+    /// @return the number of vertices written so far.
+    Index nbVertices() const;
+
+    /// @return the number of triangles written so far.
+    Index nbTriangles() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The output file.
+    std::ofstream myOut;
+    /// The temporary file of faces.
+    std::FILE* myFaces;
+    /// The format of the output file.
+    Format myFormat;
+    /// Number of vertices written.
+    Index myNbVertices;
+    /// Number of triangles written.
+    Index myNbTriangles;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    MeshStreamWriter ( const MeshStreamWriter & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    MeshStreamWriter & operator= ( const MeshStreamWriter & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Writes the header, with the current counts. Its length does
+    /// not depend on the counts, so that it can be rewritten.
+    void writeHeader();
+
+    /**
+     * Stores [v] in [buffer] in the byte order of the format.
+     * @return the address after the stored bytes.
+     */
+    char* put( char* buffer, DGtal::uint32_t v ) const;
+
+    /**
+     * Stores [v] in [buffer] in the byte order of the format.
+     * @return the address after the stored bytes.
+     */
+    char* put( char* buffer, float v ) const;
+
+  }; // end of class MeshStreamWriter
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MeshStreamWriter'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MeshStreamWriter' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const MeshStreamWriter & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/MeshStreamWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MeshStreamWriter_h
+
+#undef MeshStreamWriter_RECURSES
+#endif // else defined(MeshStreamWriter_RECURSES)
@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <complex>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CowPtr.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -307,6 +309,12 @@ namespace DGtal
     /** 
 	Convolution product of two signals (F = this).
         F*G( a ) = sum F(a-i)G(i) 
+
+        When TValue is a floating-point type and the product nk of
+        the sizes of F and G exceeds FFT_THRESHOLD, the convolution
+        is computed by FFT (see fftProduct) if it is estimated faster,
+        i.e. if nk > 3 N log2(N) with N the FFT size. Otherwise it is
+        computed directly (see directProduct).
 	
         @param G the second signal (not periodic)
 	
@@ -315,6 +323,36 @@ namespace DGtal
     */
     Signal<TValue> operator*( const Signal<TValue>& G );
 
+    /**
+        Convolution product of two signals (F = this), computed with
+        the definition, in O(nk) for signals of sizes n and k.
+
+        @param G the second signal (not periodic)
+        @return the signal that is the convolution of F and G.
+        @see operator*
+    */
+    Signal<TValue> directProduct( const Signal<TValue>& G ) const;
+
+    /**
+        Convolution product of two signals (F = this), computed by
+        fast Fourier transform in O((n+k)log(n+k)) for signals of
+        sizes n and k. A periodic signal F is circularly convolved
+        with G (G being wrapped around if longer than F). The result
+        equals the one of directProduct up to rounding errors. TValue
+        must be convertible to and from double.
+
+        @param G the second signal (not periodic)
+        @return the signal that is the convolution of F and G.
+        @see operator*
+    */
+    Signal<TValue> fftProduct( const Signal<TValue>& G ) const;
+
+    /**
+       The value of the product of the sizes of two signals below
+       which operator* always uses directProduct.
+    */
+    static const unsigned long FFT_THRESHOLD = 32768;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -341,6 +379,14 @@ namespace DGtal
       
     // ------------------------- Hidden services ----------------------------
   protected:
+
+    /**
+       In-place fast Fourier transform (radix 2).
+       @param a the sequence to transform, whose size is a power of 2.
+       @param inverse when 'true', computes the inverse transform
+       (without the 1/n factor).
+    */
+    static void fft( std::vector< std::complex<double> > & a, bool inverse );
     
 
   }; // end of class Signal
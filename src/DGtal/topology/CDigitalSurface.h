@@ -43,6 +43,7 @@
 #include <iostream>
 #include "boost/concept_check.hpp"
 #include "DGtal/base/Common.h"
+#include "DGtal/utils/ConceptUtils.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -53,15 +54,22 @@ namespace DGtal
   /**
    * Description of \b concept '\b CDigitalSurface' <p>
    * @ingroup Concepts
-   * Aim: Describes what is a digital surface in cellular topology.
+   * Aim: Describes what is a digital surface in cellular topology,
+   * i.e. a set of surfels of a cellular grid space linked by some
+   * surfel adjacency.
    * 
    * <p> Refinement of
    *
    * <p> Associated types :
+   * - KSpace: the type of cellular grid space.
+   * - Surfel: the type of signed surfels, KSpace::SCell.
+   * - Neighbors: a container of surfels, with begin(), end() and size().
    *
    * <p> Notation
    * - \t X : A type that is a model of CDigitalSurface
-   * - \t x, \t y	: Object of type X
+   * - \t x	: Object of type X
+   * - \t s	: Object of type Surfel
+   * - \t N	: Object of type Neighbors
    *
    * <p> Definitions
    *
@@ -72,14 +80,24 @@ namespace DGtal
    * <td> \b Postcondition </td> <td> \b Complexity </td>
    * </tr>
    * <tr> 
-   * <td> </td> <td> </td> <td> </td> <td> </td>
-   * <td> </td> <td> </td> <td> </td> <td> </td>
+   * <td> space </td> <td> x.space() </td> <td> </td> <td> const KSpace & </td>
+   * <td> </td> <td> the space of the surfels </td> <td> </td> <td> O(1) </td>
+   * </tr>
+   * <tr> 
+   * <td> membership </td> <td> x.isSurfel( s ) </td> <td> </td> <td> bool </td>
+   * <td> </td> <td> 'true' iff s belongs to the surface </td> <td> </td> <td> </td>
+   * </tr>
+   * <tr> 
+   * <td> neighbors </td> <td> x.neighbors( N, s ) </td> <td> </td> <td> </td>
+   * <td> s belongs to the surface </td> <td> N contains the surfels adjacent to s </td>
+   * <td> </td> <td> </td>
    * </tr>
    * </table>
    *
    * <p> Invariants <br>
    *
    * <p> Models <br>
+   * ImplicitDigitalSurface
    *
    * <p> Notes <br>
    */
@@ -88,9 +106,24 @@ namespace DGtal
   {
     // ----------------------- Concept checks ------------------------------
   public:
+    typedef typename T::KSpace KSpace;
+    typedef typename T::Surfel Surfel;
+    typedef typename T::Neighbors Neighbors;
+
+    BOOST_CONCEPT_USAGE( CDigitalSurface )
+    {
+      ConceptUtils::sameType( myKSpace, myX.space() );
+      ConceptUtils::sameType( myBool, myX.isSurfel( mySurfel ) );
+      myX.neighbors( myNeighbors, mySurfel );
+    }
     
     // ------------------------- Private Datas --------------------------------
   private:
+    T myX;
+    KSpace myKSpace;
+    Surfel mySurfel;
+    Neighbors myNeighbors;
+    bool myBool;
     
     // ------------------------- Internals ------------------------------------
   private:
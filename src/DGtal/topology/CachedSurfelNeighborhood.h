@@ -0,0 +1,275 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CachedSurfelNeighborhood.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/21
+ *
+ * Header file for module CachedSurfelNeighborhood.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CachedSurfelNeighborhood_RECURSES)
+#error Recursive header files inclusion detected in CachedSurfelNeighborhood.h
+#else // defined(CachedSurfelNeighborhood_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CachedSurfelNeighborhood_RECURSES
+
+#if !defined CachedSurfelNeighborhood_h
+/** Prevents repeated inclusion of headers. */
+#define CachedSurfelNeighborhood_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CachedSurfelNeighborhood
+  /**
+     Description of template class 'CachedSurfelNeighborhood' <p>
+     \brief Aim: A SurfelNeighborhood specialized for tracking the
+     boundary of a shape given by a predicate on points.
+
+     It gives the same adjacent surfels as
+     SurfelNeighborhood::getAdjacentOnPointPredicate, but:
+     - the followers and the spels around the current surfel are
+       computed directly on Khalimsky coordinates, the tracking
+       directions of each orthogonal direction being tabulated;
+     - the values of the predicate are kept in a direct-mapped cache
+       of spels, since a spel adjacent to the current surfel is
+       usually also adjacent to the surfels tracked just before or
+       just after.
+
+     The cache is modified by getAdjacentOnPointPredicate, hence an
+     object should not be shared between threads. It is used by
+     Surfaces::trackBoundary and Surfaces::trackClosedBoundary.
+
+     @tparam TKSpace the type of cellular grid space, a model of
+     CCellularGridSpaceND like KhalimskySpaceND.
+
+     @tparam TPointPredicate a model of CPointPredicate describing
+     the inside of the shape.
+
+     @code
+     CachedSurfelNeighborhood<KSpace, Shape> SN( K, SAdj, shape );
+     SN.setSurfel( bel );
+     for ( Dimension i = 0; i < SN.nbTrackDirs(); ++i )
+       if ( SN.getAdjacentOnPointPredicate( bn, SN.trackDir( i ), true ) )
+         ...
+     @endcode
+  */
+  template <typename TKSpace, typename TPointPredicate>
+  class CachedSurfelNeighborhood
+  {
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+  public:
+    typedef TKSpace KSpace;
+    typedef TPointPredicate PointPredicate;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef SurfelAdjacency<KSpace::dimension> Adjacency;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~CachedSurfelNeighborhood();
+
+    /**
+     * Constructor. The space, adjacency and predicate are only
+     * referenced and must outlive the object.
+     *
+     * @param K any cellular grid space.
+     * @param adj the surfel adjacency.
+     * @param pp the predicate describing the inside of the shape.
+     * @param cacheSize the number of spels whose predicate value is
+     * cached (rounded up to a power of two), 0 means no cache.
+     */
+    CachedSurfelNeighborhood( const KSpace & K, const Adjacency & adj,
+			      const PointPredicate & pp,
+			      Size cacheSize = 4096 );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    CachedSurfelNeighborhood( const CachedSurfelNeighborhood & other );
+
+    /**
+       Sets the neighborhood to the given [surfel].
+       @param aSurfel any signed bel of the shape, its positive
+       incident spel being inside.
+    */
+    void setSurfel( const SCell & aSurfel );
+
+    /** @return the current surfel. */
+    const SCell & surfel() const;
+
+    /** @return the orthogonal direction to the current surfel. */
+    Dimension orthDir() const;
+
+    /** @return the number of tracking directions, i.e. 'dim-1'. */
+    Dimension nbTrackDirs() const;
+
+    /**
+       @param i any index between 0 and nbTrackDirs()-1.
+       @return the [i]-th tracking direction of the current surfel,
+       in increasing order as KSpace::sDirs.
+    */
+    Dimension trackDir( Dimension i ) const;
+
+    // ----------------------- Surfel adjacency services --------------------
+  public:
+
+    /**
+       Go to the next direct or indirect adjacent bel on the boundary
+       of the shape, as SurfelNeighborhood::getAdjacentOnPointPredicate.
+
+       @param adj_surfel (returns) the signed adjacent surfel in
+       direction [track_dir] if there is one.
+       @param track_dir the direction where to look for the spel.
+       @param pos when 'true' look in positive direction along
+       [track_dir] axis, 'false' look in negative direction.
+
+       @return 0 if the move was impossible (no bels in this direction),
+       1 if it was the first interior, 2 if it was the second interior,
+       3 if it was the third interior.
+    */
+    unsigned int getAdjacentOnPointPredicate( SCell & adj_surfel,
+					      Dimension track_dir,
+					      bool pos );
+
+    /**
+       @param p any point of the space.
+       @return the value of the predicate at [p], possibly cached.
+    */
+    bool isInside( const Point & p );
+
+    /// @return the number of entries of the cache.
+    Size cacheSize() const;
+
+    /**
+     * Empties the cache, e.g. when the predicate has changed.
+     */
+    void clearCache();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The cellular space.
+    const KSpace & mySpace;
+    /// The surfel adjacency.
+    const Adjacency & mySurfelAdj;
+    /// The predicate describing the inside of the shape.
+    const PointPredicate & myPointPredicate;
+    /// The tracking directions of each orthogonal direction.
+    Dimension myTrackDirs[ Point::dimension ][ Point::dimension ];
+    /// The current surfel.
+    SCell mySurfel;
+    /// The orthogonal direction to the current surfel.
+    Dimension myOrthDir;
+    /// The Khalimsky coordinates of the inner spel of the surfel.
+    Point myInnerK;
+    /// The Khalimsky coordinates of the outer spel of the surfel.
+    Point myOuterK;
+    /// The digital coordinates of the inner spel.
+    Point myInner;
+    /// The digital coordinates of the outer spel.
+    Point myOuter;
+    /// The spels of the cache.
+    std::vector<Point> myCachePoints;
+    /// The values of the cache: 0 unknown, 1 outside, 2 inside.
+    std::vector<unsigned char> myCacheValues;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    CachedSurfelNeighborhood();
+
+  private:
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default (references).
+     */
+    CachedSurfelNeighborhood & operator= ( const CachedSurfelNeighborhood & other );
+
+  }; // end of class CachedSurfelNeighborhood
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CachedSurfelNeighborhood'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CachedSurfelNeighborhood' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TPointPredicate>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const CachedSurfelNeighborhood<TKSpace, TPointPredicate> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/CachedSurfelNeighborhood.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CachedSurfelNeighborhood_h
+
+#undef CachedSurfelNeighborhood_RECURSES
+#endif // else defined(CachedSurfelNeighborhood_RECURSES)
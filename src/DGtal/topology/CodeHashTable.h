@@ -0,0 +1,302 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CodeHashTable.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/10/10
+ *
+ * Header file for module CodeHashTable.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CodeHashTable_RECURSES)
+#error Recursive header files inclusion detected in CodeHashTable.h
+#else // defined(CodeHashTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CodeHashTable_RECURSES
+
+#if !defined CodeHashTable_h
+/** Prevents repeated inclusion of headers. */
+#define CodeHashTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+     Value type of a CodeHashTable that stores no value, i.e. a set
+     of codes.
+  */
+  struct CodeHashTableNoValue {};
+
+  /**
+     Values of the slots of a CodeHashTable, stored in a vector
+     parallel to the codes.
+  */
+  template <typename TValue>
+  class CodeHashTableValues
+  {
+  public:
+    void resize( std::size_t n ) { myValues.resize( n ); }
+    TValue & operator[]( std::size_t i ) { return myValues[ i ]; }
+    const TValue & operator[]( std::size_t i ) const { return myValues[ i ]; }
+    void swap( CodeHashTableValues & other ) { myValues.swap( other.myValues ); }
+  private:
+    std::vector<TValue> myValues;
+  };
+
+  /**
+     Specialization for tables without values, which take no memory.
+  */
+  template <>
+  class CodeHashTableValues<CodeHashTableNoValue>
+  {
+  public:
+    void resize( std::size_t ) {}
+    CodeHashTableNoValue & operator[]( std::size_t ) { return myValue; }
+    const CodeHashTableNoValue & operator[]( std::size_t ) const { return myValue; }
+    void swap( CodeHashTableValues & ) {}
+  private:
+    CodeHashTableNoValue myValue;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CodeHashTable
+  /**
+     Description of template class 'CodeHashTable' <p> \brief Aim:
+     An open-addressing hash table of cell codes (see
+     KhalimskyCellCoder), possibly associated to values. It is the
+     storage of SCellHashSet, and it maps pointels to vertices in
+     SurfaceMeshExtractor.
+
+     The table uses linear probing, its capacity is a power of two
+     and it is kept at most half full. Erasing an element shifts back
+     the following elements of its cluster, hence there are no
+     tombstones. Elements are designated by the index of their slot,
+     which is valid until the next insertion.
+
+     @tparam TCoder the type of cell coder, which gives the type Code
+     and the static hash function (e.g. KhalimskyCellCoder).
+
+     @tparam TValue the type of values associated to codes, or
+     CodeHashTableNoValue for a set of codes.
+
+     @code
+     CodeHashTable<Coder, unsigned int> table;
+     std::pair<std::size_t,bool> r = table.insert( coder.uCode( pointel ) );
+     if ( r.second ) table.value( r.first ) = nbVertices++;
+     @endcode
+  */
+  template <typename TCoder, typename TValue = CodeHashTableNoValue>
+  class CodeHashTable
+  {
+  public:
+    typedef TCoder Coder;
+    typedef typename Coder::Code Code;
+    typedef TValue Value;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~CodeHashTable();
+
+    /**
+     * Constructor of an empty table without slots.
+     */
+    CodeHashTable();
+
+    /**
+     * Swaps the content of 'this' and [other] in constant time.
+     * @param other any other table.
+     */
+    void swap( CodeHashTable & other );
+
+    // ----------------------- Table services ---------------------------------
+  public:
+
+    /// @return the number of codes in the table.
+    Size size() const;
+
+    /// @return 'true' iff the table is empty.
+    bool empty() const;
+
+    /// @return the number of slots of the table.
+    Size capacity() const;
+
+    /**
+     * Empties the table, but keeps its capacity.
+     */
+    void clear();
+
+    /**
+     * Makes room for [n] codes without rehashing.
+     * @param n any number of codes.
+     */
+    void reserve( Size n );
+
+    /**
+     * Inserts a code. The value of a new code is the one left in its
+     * slot, and should be set by the caller.
+     *
+     * @param code any code different from emptyCode().
+     * @return the slot of [code] and 'true' iff it was not already
+     * in the table.
+     */
+    std::pair<Size,bool> insert( Code code );
+
+    /**
+     * @param code any code.
+     * @return the slot of [code], or capacity() if it is not in the table.
+     */
+    Size find( Code code ) const;
+
+    /**
+     * Removes a code from the table.
+     * @param code any code.
+     * @return 'true' iff [code] was in the table.
+     */
+    bool erase( Code code );
+
+    /**
+     * Removes all the codes satisfying a predicate, and shrinks the
+     * table to fit the remaining ones.
+     *
+     * @tparam CodePredicate a functor from Code to bool.
+     * @param pred the predicate.
+     * @return the number of removed codes.
+     */
+    template <typename CodePredicate>
+    Size removeIf( const CodePredicate & pred );
+
+    /**
+     * @param s any slot.
+     * @return the code of slot [s], emptyCode() if it is empty.
+     */
+    Code code( Size s ) const;
+
+    /**
+     * @param s any used slot.
+     * @return a reference on the value of slot [s].
+     */
+    Value & value( Size s );
+
+    /**
+     * @param s any used slot.
+     * @return a const reference on the value of slot [s].
+     */
+    const Value & value( Size s ) const;
+
+    /**
+       @param s any slot index.
+       @return the index of the first used slot from [s], or the
+       capacity if there is none.
+    */
+    Size nextUsedSlot( Size s ) const;
+
+    /**
+       Code of empty slots. It is not the code of any cell since the
+       Khalimsky coordinates of a cell relative to the lowest cell
+       of the space are at most the extent of the space, which is
+       even, whereas all the bits of the field would make it odd.
+    */
+    static Code emptyCode();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the capacity is zero or a power of two
+     * at least twice the size.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The table of codes, empty slots are emptyCode().
+    std::vector<Code> myCodes;
+    /// The value of each slot.
+    CodeHashTableValues<Value> myValues;
+    /// The number of codes in the table.
+    Size mySize;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param code any code.
+       @return the slot holding [code] or the empty slot where it
+       should be inserted.
+    */
+    Size slot( Code code ) const;
+
+    /**
+       Reinserts all the codes in a table with [n] slots.
+       @param n a power of two at least twice the size.
+    */
+    void rehash( Size n );
+
+  }; // end of class CodeHashTable
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CodeHashTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CodeHashTable' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCoder, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const CodeHashTable<TCoder,TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/CodeHashTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CodeHashTable_h
+
+#undef CodeHashTable_RECURSES
+#endif // else defined(CodeHashTable_RECURSES)
@@ -41,7 +41,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
 #include "DGtal/topology/DomainAdjacency.h"
@@ -68,6 +70,15 @@ namespace DGtal
    * initial core. The expander move layer by layer but the user is
    * free to navigate on each layer.
    *
+   * The expansion is level-synchronous: visited points are marked in
+   * a bitmap spanning the bounding box of the object and
+   * each layer is kept as a frontier of points. Neighbors of the
+   * frontier are gathered in per-thread buffers (when DGtal is built
+   * WITH_OPENMP), which are merged at the end of each level. The sets
+   * returned by core() and layer() are only filled on demand, so that
+   * an expansion that only uses distance() or the point ranges does
+   * not pay for set insertions.
+   *
    * @tparam TObject the type of the digital object.
    *
    * @code
@@ -89,6 +100,17 @@ namespace DGtal
    *   }
    * @endcode
    *
+   * The expander may also write directly the geodesic distance of
+   * each visited point into an image, possibly stopping at a given
+   * distance or as soon as some target point is reached.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector< Domain, unsigned int > DistanceImage;
+   * DistanceImage image( domain.lowerBound(), domain.upperBound() );
+   * ObjectExpander expander( object, seeds.begin(), seeds.end() );
+   * expander.writeDistances( image, 30 ); // stops at distance 30.
+   * @endcode
+   *
    * @see testExpander.cpp
    * @see testObject.cpp
    */
@@ -106,6 +128,7 @@ namespace DGtal
     typedef typename Object::DigitalTopology DigitalTopology;
     typedef typename Object::ForegroundAdjacency ForegroundAdjacency;
     typedef typename Domain::Space Space;
+    typedef typename Space::Dimension Dimension;
     typedef typename DigitalSet::Iterator Iterator;
     typedef typename DigitalSet::ConstIterator ConstIterator;
     typedef DigitalSetDomain<DigitalSet> ObjectDomain;
@@ -116,6 +139,8 @@ namespace DGtal
     typedef typename CoreDomain::Predicate InCoreDomainPredicate; 
     //typedef DomainPredicate< CoreDomain > InCoreDomainPredicate;
     typedef NotPointPredicate< InCoreDomainPredicate > NotInCoreDomainPredicate;
+    typedef std::vector<Point> PointVector;
+    typedef typename PointVector::const_iterator PointConstIterator;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -175,14 +200,82 @@ namespace DGtal
 
     /**
      * @return a const reference on the (current) core set of points.
+     * The set is updated lazily from the visited points.
      */
     const DigitalSet & core() const;
 
     /**
      * @return a const reference on the (current) layer set of points.
+     * The set is updated lazily from the current frontier.
      */
     const DigitalSet & layer() const;
 
+    /**
+     * @return the iterator on the first point of the current layer,
+     * taken directly in the frontier (no set is built).
+     */
+    PointConstIterator layerBegin() const;
+
+    /**
+     * @return the iterator after the last point of the current layer,
+     * taken directly in the frontier (no set is built).
+     */
+    PointConstIterator layerEnd() const;
+
+    /**
+     * @return the number of points of the current layer.
+     */
+    Size layerSize() const;
+
+    /**
+     * Writes the distance of every point visited so far into [image],
+     * then goes on with the expansion until it is finished, writing
+     * the distance of each point of each new layer. Points of the
+     * image that are not reached keep their value.
+     *
+     * @tparam TImage any model of CImageContainer whose domain
+     * contains the object and whose values can be built from a Size.
+     *
+     * @param image (modified) the image where distances are written.
+     */
+    template <typename TImage>
+    void writeDistances( TImage & image );
+
+    /**
+     * Same as writeDistances( image ) but stops when the expansion
+     * reaches distance [maxDistance]: only points at a distance lower
+     * or equal to [maxDistance] are written.
+     *
+     * @tparam TImage any model of CImageContainer whose domain
+     * contains the object and whose values can be built from a Size.
+     *
+     * @param image (modified) the image where distances are written.
+     * @param maxDistance the maximal distance of the expansion.
+     */
+    template <typename TImage>
+    void writeDistances( TImage & image, Size maxDistance );
+
+    /**
+     * Same as writeDistances( image, maxDistance ) but stops also
+     * after the first layer containing a point of the target. This
+     * layer is completely written.
+     *
+     * @tparam TImage any model of CImageContainer whose domain
+     * contains the object and whose values can be built from a Size.
+     * @tparam TPointPredicate any model of CPointPredicate.
+     *
+     * @param image (modified) the image where distances are written.
+     * @param maxDistance the maximal distance of the expansion.
+     * @param target the predicate defining the target set.
+     *
+     * @return 'true' if a point of the target has been reached,
+     * 'false' otherwise. In the first case, distance() is the
+     * geodesic distance from the initial core to the target.
+     */
+    template <typename TImage, typename TPointPredicate>
+    bool writeDistances( TImage & image, Size maxDistance,
+			 const TPointPredicate & target );
+
     /**
      * @return the iterator on the first element of the layer.
      */
@@ -213,6 +306,27 @@ namespace DGtal
     // ------------------------- Private Datas --------------------------------
   private:
 
+    /**
+     * State of a point of the bounding box of the object in the visited bitmap.
+     */
+    enum PointState { OUTSIDE = 0, UNVISITED = 1, VISITED = 2 };
+
+    /**
+     * Predicate returning 'true' for points of the object that have
+     * not been visited yet. Used to filter the neighborhoods of the
+     * frontier.
+     */
+    struct UnvisitedPredicate
+    {
+      UnvisitedPredicate( const Expander<TObject> & expander )
+	: myExpander( expander ) {}
+      bool operator()( const Point & p ) const
+      {
+	return myExpander.state( p ) == UNVISITED;
+      }
+      const Expander<TObject> & myExpander;
+    };
+
     /**
      * The domain in which the object is lying.
      */
@@ -224,45 +338,84 @@ namespace DGtal
     const Object & myObject;
 
     /**
-     * The domain corresponding to the object.
+     * Lower bound of the bounding box of the object.
      */
-    ObjectDomain myObjectDomain;
+    Point myLowerBound;
 
     /**
-     * The adjacency that is used in myObjectDomain.
+     * Upper bound of the bounding box of the object.
      */
-    ObjectAdjacency myObjectAdjacency;
+    Point myUpperBound;
 
     /**
-     * Set representing the core of the expansion: the expansion should not
-     * enter the core.
+     * Offsets used to linearize points of the bounding box.
      */
-    DigitalSet myCore;
+    std::size_t myStrides[ Space::dimension ];
 
     /**
-     * Set representing the current layer.
+     * Bitmap of point states (OUTSIDE, UNVISITED or VISITED), indexed
+     * by the linearized points of the bounding box of the object.
      */
-    DigitalSet myLayer;
+    std::vector<unsigned char> myStates;
 
     /**
-     * Current distance to origin.
+     * All the visited points, in the order of their visit. The core is
+     * the range [0,myCoreEnd) and the current layer is the range
+     * [myLayerBegin,myVisited.size()).
      */
-    Size myDistance;
+    PointVector myVisited;
 
     /**
-     * Boolean stating whether the expansion is over or not.
+     * Index after the last point of the core in myVisited.
      */
-    bool myFinished;
+    Size myCoreEnd;
+
+    /**
+     * Index of the first point of the current layer in myVisited.
+     */
+    Size myLayerBegin;
+
+    /**
+     * Index of the first point of each layer in myVisited. The layer
+     * at distance i starts at myLayerStarts[ i ].
+     */
+    std::vector<Size> myLayerStarts;
+
+    /**
+     * Per-thread buffers where neighbors of the frontier are gathered
+     * before being merged in the next layer.
+     */
+    std::vector<PointVector> myBuffers;
 
     /**
-     * Predicate in-core.
+     * Set representing the core of the expansion (lazily updated).
      */
-    InCoreDomainPredicate myInCorePred;
+    mutable DigitalSet myCore;
 
     /**
-     * Predicate ensuring the not-in-core expansion. 
+     * Number of points of myVisited already inserted in myCore.
      */
-    NotInCoreDomainPredicate myNotInCorePred;
+    mutable Size myCoreSetSize;
+
+    /**
+     * Set representing the current layer (lazily updated).
+     */
+    mutable DigitalSet myLayer;
+
+    /**
+     * 'true' when myLayer represents the current layer.
+     */
+    mutable bool myLayerSetUpToDate;
+
+    /**
+     * Current distance to origin.
+     */
+    Size myDistance;
+
+    /**
+     * Boolean stating whether the expansion is over or not.
+     */
+    bool myFinished;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -274,21 +427,48 @@ namespace DGtal
     Expander();
 
     /**
-     * Computes the next layer just around [src]. The member 'm_core' must
-     * be up to date (i.e, [src] is a subset of 'm_core').  'm_layer' is
-     * cleared in this method.  At first call, [src] should be 'm_core',
-     * then [src] should be 'm_layer'.
+     * Computes the next layer just around the visited points of
+     * indices [srcBegin,srcEnd). The core must be up to date (i.e,
+     * these points belong to the core). At first call, the range
+     * should be the initial core, then it should be the current layer.
      *
-     * @param src the set around which the new layer is computed.
+     * @param srcBegin the index of the first point of the frontier.
+     * @param srcEnd the index after the last point of the frontier.
      */
-    void computeNextLayer( const DigitalSet & src );
+    void computeNextLayer( Size srcBegin, Size srcEnd );
 
     /**
-     * Push the layer into the current core and clear it. Must be called
-     * before computeNewLayer.
+     * Push the layer into the current core. Must be called before
+     * computeNextLayer.
      */
     void endLayer();
 
+    /**
+     * Initializes the bitmap of point states from the object.
+     */
+    void initStates();
+
+    /**
+     * Marks the point [p] as visited and appends it to the visited
+     * points.
+     *
+     * @param p any unvisited point of the object.
+     */
+    void visit( const Point & p );
+
+    /**
+     * @param p any point of the space.
+     * @return the state of [p] (OUTSIDE if [p] lies outside the
+     * bounding box of the object).
+     */
+    unsigned char state( const Point & p ) const;
+
+    /**
+     * @param p any point of the bounding box of the object.
+     * @return the index of [p] in the bitmap of point states.
+     */
+    std::size_t linearized( const Point & p ) const;
+
   private:
 
     /**
@@ -0,0 +1,299 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImplicitDigitalSurface.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/13
+ *
+ * Header file for module ImplicitDigitalSurface.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImplicitDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in ImplicitDigitalSurface.h
+#else // defined(ImplicitDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImplicitDigitalSurface_RECURSES
+
+#if !defined ImplicitDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define ImplicitDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/KhalimskyCellCoder.h"
+#include "DGtal/topology/SCellHashSet.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImplicitDigitalSurface
+  /**
+     Description of template class 'ImplicitDigitalSurface' <p>
+     \brief Aim: A model of CDigitalSurface, which is the boundary of
+     a shape given by a predicate on points, within a cellular grid
+     space, and whose surfels are linked by a surfel adjacency.
+
+     Nothing is stored: the surfels of the surface are the bels of
+     the shape, and the neighbors of a surfel are computed on the fly
+     by SurfelNeighborhood::getAdjacentOnPointPredicate. It is thus
+     suited to local computations on the boundary of huge implicit
+     shapes, which could not be tracked entirely with
+     Surfaces::trackBoundary.
+
+     Since each neighbor costs up to three evaluations of the
+     predicate, the neighbors of the last surfels may be kept in a
+     direct-mapped cache of a given number of entries. The cache is
+     modified by const queries, hence an object with a cache should
+     not be shared between threads (copy it instead).
+
+     @tparam TKSpace the type of cellular grid space, a model of
+     CCellularGridSpaceND like KhalimskySpaceND.
+
+     @tparam TPointPredicate a model of CPointPredicate describing
+     the inside of the shape.
+
+     @code
+     typedef ImplicitDigitalSurface<KSpace, ImplicitBall> Surface;
+     Surface surface( K, ball, SurfelAdjacency<3>( true ), 1024 );
+     Surface::Neighbors N;
+     surface.neighbors( N, bel );
+     std::vector<Surface::Surfel> patch;
+     surface.ball( patch, bel, 5 );
+     @endcode
+  */
+  template <typename TKSpace, typename TPointPredicate>
+  class ImplicitDigitalSurface
+  {
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+  public:
+    typedef TKSpace KSpace;
+    typedef TPointPredicate PointPredicate;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::SCell Surfel;
+    typedef typename KSpace::DirIterator DirIterator;
+    typedef SurfelAdjacency<KSpace::dimension> Adjacency;
+    typedef KhalimskyCellCoder<KSpace> Coder;
+    typedef typename Coder::Code Code;
+    typedef std::size_t Size;
+
+    /// The neighbors of a surfel, at most two per tracking direction.
+    typedef typename KSpace::template
+    AnyCellArray<SCell, 2 * ( Point::dimension - 1 )> Neighbors;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~ImplicitDigitalSurface();
+
+    /**
+     * Constructor. The space, predicate and adjacency are only
+     * referenced and must outlive the object.
+     *
+     * @param K any cellular grid space.
+     * @param pp the predicate describing the inside of the shape.
+     * @param adj the surfel adjacency linking surfels.
+     * @param cacheSize the number of surfels whose neighbors are
+     * cached (rounded up to a power of two), 0 means no cache. The
+     * cache is used only if the cells of [K] fit in a code.
+     */
+    ImplicitDigitalSurface( const KSpace & K,
+			    const PointPredicate & pp,
+			    const Adjacency & adj,
+			    Size cacheSize = 0 );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ImplicitDigitalSurface( const ImplicitDigitalSurface & other );
+
+    /// @return the cellular grid space.
+    const KSpace & space() const;
+
+    /// @return the predicate describing the inside of the shape.
+    const PointPredicate & pointPredicate() const;
+
+    /// @return the surfel adjacency.
+    const Adjacency & surfelAdjacency() const;
+
+    // ----------------------- Surface services -------------------------------
+  public:
+
+    /**
+       @param s any signed cell of the space.
+       @return 'true' iff [s] is a surfel whose direct incident spel
+       is inside the shape and whose indirect incident spel is
+       outside, i.e. a bel as given by Surfaces::findABel.
+    */
+    bool isSurfel( const SCell & s ) const;
+
+    /**
+       @param adj_surfel (returns) the surfel adjacent to [s] in
+       direction [track_dir] if there is one.
+       @param s any surfel of the surface.
+       @param track_dir any direction different from the orthogonal
+       direction of [s].
+       @param pos when 'true' look in positive direction along
+       [track_dir] axis, 'false' look in negative direction.
+       @return 'false' if there is no adjacent surfel (border of the
+       space), 'true' otherwise.
+    */
+    bool adjacent( SCell & adj_surfel, const SCell & s,
+		   Dimension track_dir, bool pos ) const;
+
+    /**
+       @param N (returns) the surfels adjacent to [s], along each
+       tracking direction in increasing order, positive direction
+       first.
+       @param s any surfel of the surface.
+    */
+    void neighbors( Neighbors & N, const SCell & s ) const;
+
+    /**
+       @param s any surfel of the surface.
+       @return the number of surfels adjacent to [s], which is 2(n-1)
+       unless [s] touches the border of the space.
+    */
+    Size degree( const SCell & s ) const;
+
+    /**
+       Computes the surfels at distance at most [radius] from [s] in
+       the adjacency graph of the surface, in breadth-first order.
+
+       @param result (returns) the surfels of the ball, starting with [s].
+       @param s any surfel of the surface.
+       @param radius the radius of the ball.
+    */
+    void ball( std::vector<SCell> & result, const SCell & s,
+	       unsigned int radius ) const;
+
+    // ----------------------- Cache services ---------------------------------
+  public:
+
+    /// @return the number of entries of the cache (0 if none).
+    Size cacheSize() const;
+
+    /// Forgets all the cached neighborhoods.
+    void clearCache();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// An entry of the cache: a surfel code and its neighbors.
+    struct CacheEntry {
+      Code code;
+      Neighbors neighbors;
+    };
+
+    /// The cellular grid space.
+    const KSpace & mySpace;
+    /// The predicate describing the inside of the shape.
+    const PointPredicate & myPointPredicate;
+    /// The surfel adjacency.
+    const Adjacency & mySurfelAdj;
+    /// Encodes surfels for the cache and the balls.
+    Coder myCoder;
+    /// The direct-mapped cache of neighborhoods (empty if none).
+    mutable std::vector<CacheEntry> myCache;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ImplicitDigitalSurface & operator=( const ImplicitDigitalSurface & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Computes the neighbors of [s] without the cache.
+    */
+    void computeNeighbors( Neighbors & N, const SCell & s ) const;
+
+    /**
+       Breadth-first traversal for ball, [visited] being any empty
+       set of SCell.
+    */
+    template <typename SCellSet>
+    void ballInSet( std::vector<SCell> & result, SCellSet & visited,
+		    const SCell & s, unsigned int radius ) const;
+
+  }; // end of class ImplicitDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImplicitDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImplicitDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TPointPredicate>
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const ImplicitDigitalSurface<TKSpace, TPointPredicate> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ImplicitDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImplicitDigitalSurface_h
+
+#undef ImplicitDigitalSurface_RECURSES
+#endif // else defined(ImplicitDigitalSurface_RECURSES)
@@ -0,0 +1,334 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file KhalimskyCellCoder.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/09
+ *
+ * Header file for module KhalimskyCellCoder.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(KhalimskyCellCoder_RECURSES)
+#error Recursive header files inclusion detected in KhalimskyCellCoder.h
+#else // defined(KhalimskyCellCoder_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define KhalimskyCellCoder_RECURSES
+
+#if !defined KhalimskyCellCoder_h
+/** Prevents repeated inclusion of headers. */
+#define KhalimskyCellCoder_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellCoder
+  /**
+     Description of template class 'KhalimskyCellCoder' <p> \brief
+     Aim: Encodes the cells of a given cellular grid space as 64-bit
+     integers, for compact storage of large sets of cells (typically
+     surfels) and fast hashing, comparison and incidence.
+
+     The code of a signed cell stores its sign in the lowest bit,
+     then the Khalimsky coordinates of the cell, relative to the
+     lowest cell of the space, in consecutive bit fields, the first
+     coordinate in the lowest field. Each field is just wide enough
+     for the extent of the space along its axis. Hence:
+
+     - the code of an unsigned cell is the code of its positive
+       signed cell, i.e. with a null lowest bit;
+     - the natural order of codes is the lexicographic order of the
+       cells starting from the last coordinate, then the sign, which
+       is the scanning order of images and domains;
+     - incident and adjacent cells are obtained by adding or
+       subtracting a power of two;
+     - hashing a cell is hashing a single integer.
+
+     The space must be small enough for its codes to fit in 64 bits
+     (e.g. less than 2^20 spels along each axis in 3D), see isValid().
+     As for the space, incidence and adjacency services do not check
+     that the resulting cell lies within the space.
+
+     @tparam TKSpace the type of cellular grid space, a model of
+     CCellularGridSpaceND like KhalimskySpaceND.
+
+     @code
+     KSpace K;
+     K.init( low, high, true );
+     KhalimskyCellCoder<KSpace> coder( K );
+     KhalimskyCellCoder<KSpace>::Code code = coder.sCode( surfel );
+     code = coder.sIncident( code, k, true ); // a (d-2)-cell of surfel
+     SCell linel = coder.sCell( code );
+     @endcode
+  */
+  template <typename TKSpace>
+  class KhalimskyCellCoder
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Cell Cell;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Sign Sign;
+    /// The type used to encode cells.
+    typedef DGtal::uint64_t Code;
+
+    /// The dimension of the space.
+    static const Dimension dimension = Point::dimension;
+
+    /**
+       Hash functor for codes, usable by hash containers.
+    */
+    struct Hash {
+      inline std::size_t operator()( Code c ) const
+      { return KhalimskyCellCoder::hash( c ); }
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~KhalimskyCellCoder();
+
+    /**
+     * Constructor. The object is not valid and its fields are null.
+     */
+    KhalimskyCellCoder();
+
+    /**
+     * Constructor from a space.
+     * @param K any cellular grid space.
+     * @see init
+     */
+    KhalimskyCellCoder( const KSpace & K );
+
+    /**
+     * Computes the bit fields for the cells of the space [K].
+     *
+     * @param K any cellular grid space.
+     * @return 'true' if the cells of [K] fit in a code, 'false' otherwise.
+     */
+    bool init( const KSpace & K );
+
+    // ----------------------- Encoding services ------------------------------
+  public:
+
+    /**
+       @param c any unsigned cell of the space.
+       @return its code (with a null sign bit).
+    */
+    Code uCode( const Cell & c ) const;
+
+    /**
+       @param c any signed cell of the space.
+       @return its code.
+    */
+    Code sCode( const SCell & c ) const;
+
+    /**
+       @param code the code of a cell.
+       @return the corresponding unsigned cell.
+    */
+    Cell uCell( Code code ) const;
+
+    /**
+       @param code the code of a cell.
+       @return the corresponding signed cell.
+    */
+    SCell sCell( Code code ) const;
+
+    /**
+       @param code the code of a cell.
+       @param k any coordinate.
+       @return its [k]-th Khalimsky coordinate.
+    */
+    Integer kCoord( Code code, Dimension k ) const;
+
+    // ----------------------- Sign services ----------------------------------
+  public:
+
+    /**
+       @param code the code of a signed cell.
+       @return its sign.
+    */
+    static Sign sSign( Code code );
+
+    /**
+       @param code the code of a cell.
+       @param s any sign.
+       @return the code of the cell with sign [s].
+    */
+    static Code signs( Code code, Sign s );
+
+    /**
+       @param code the code of a cell.
+       @return the code of the unsigned cell (i.e. positive sign).
+    */
+    static Code unsigns( Code code );
+
+    /**
+       @param code the code of a signed cell.
+       @return the code of the opposite cell.
+    */
+    static Code sOpp( Code code );
+
+    // ----------------------- Topology services ------------------------------
+  public:
+
+    /**
+       @param code the code of a cell.
+       @param k any coordinate.
+       @return 'true' iff the cell is open along [k].
+    */
+    bool isOpen( Code code, Dimension k ) const;
+
+    /**
+       @param code the code of a cell.
+       @return the dimension of the cell.
+    */
+    Dimension dim( Code code ) const;
+
+    /**
+       @param code the code of an unsigned cell.
+       @param k any coordinate.
+       @param up if 'true' the orientation is forward along axis
+       [k], otherwise backward.
+       @return the code of the cell incident to [code] along [k] in the
+       given orientation (@see KhalimskySpaceND::uIncident).
+    */
+    Code uIncident( Code code, Dimension k, bool up ) const;
+
+    /**
+       @param code the code of a signed cell.
+       @param k any coordinate.
+       @param up if 'true' the orientation is forward along axis
+       [k], otherwise backward.
+       @return the code of the signed cell incident to [code] along
+       [k] in the given orientation, with the sign given by
+       KhalimskySpaceND::sIncident.
+    */
+    Code sIncident( Code code, Dimension k, bool up ) const;
+
+    /**
+       @param code the code of a cell.
+       @param k any coordinate.
+       @param up if 'true' the orientation is forward along axis
+       [k], otherwise backward.
+       @return the code of the adjacent cell along [k] in the given
+       orientation (same topology and sign).
+    */
+    Code adjacent( Code code, Dimension k, bool up ) const;
+
+    /**
+       @param code any code.
+       @return a well-mixed hash value for [code], suitable for open
+       addressing hash tables.
+    */
+    static std::size_t hash( Code code );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is initialized with a space whose
+     * cells fit in a code.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Khalimsky coordinates of the lowest cell of the space.
+    Point myLower;
+    /// Position of the lowest bit of each coordinate field.
+    unsigned int myShifts[ dimension ];
+    /// Mask of each coordinate field (not shifted).
+    Code myMasks[ dimension ];
+    /// Lowest bit of every field of an odd coordinate of myLower.
+    Code myLowerParity;
+    /// For each k, lowest bits of the fields of coordinates 0 to k.
+    Code myPrefixLowBits[ dimension ];
+    /// Number of bits used by codes.
+    unsigned int myNbBits;
+    /// 'true' if the codes of the space fit in 64 bits.
+    bool myIsValid;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param code the code of a cell.
+       @return the lowest bit of the field of every coordinate along
+       which the cell is open.
+    */
+    Code openBits( Code code ) const;
+
+    /**
+       @param x any code.
+       @return 'true' iff [x] has an odd number of set bits.
+    */
+    static bool oddParity( Code x );
+
+  }; // end of class KhalimskyCellCoder
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'KhalimskyCellCoder'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'KhalimskyCellCoder' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const KhalimskyCellCoder<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/KhalimskyCellCoder.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined KhalimskyCellCoder_h
+
+#undef KhalimskyCellCoder_RECURSES
+#endif // else defined(KhalimskyCellCoder_RECURSES)
@@ -412,6 +412,27 @@ namespace DGtal
     void find();
   };
 
+  /**
+   * Compile-time sizes of the local configurations of a cell in a
+   * cellular grid space of dimension [dim]: maximal number of cells
+   * in a 1-neighborhood (cell included), maximal number of directly
+   * incident cells, and number of cells in the closure (or the
+   * star) of a cell, i.e. 3^dim.
+   */
+  template < Dimension dim >
+  struct KhalimskyLocalSizes
+  {
+    enum { NEIGHBORHOOD = 2 * dim + 1,
+	   INCIDENCE = 2 * dim,
+	   CLOSURE = 3 * KhalimskyLocalSizes< dim - 1 >::CLOSURE };
+  };
+
+  template <>
+  struct KhalimskyLocalSizes< 0 >
+  {
+    enum { NEIGHBORHOOD = 1, INCIDENCE = 0, CLOSURE = 1 };
+  };
+
 
   /////////////////////////////////////////////////////////////////////////////
   // template class KhalimskySpaceND
@@ -490,6 +511,48 @@ namespace DGtal
     typedef AnyCellCollection<Cell> Cells;
     typedef AnyCellCollection<SCell> SCells;
 
+    /**
+       A collection of at most [capacity] cells stored in place
+       (typically on the stack). It is filled by the allocation-free
+       neighborhood and incidence services and offers a subset of the
+       STL sequence interface.
+    */
+    template <typename CellType, unsigned int capacity>
+    struct AnyCellArray {
+      typedef CellType ValueType;
+      typedef CellType value_type;
+      typedef CellType* Iterator;
+      typedef const CellType* ConstIterator;
+      typedef unsigned int SizeType;
+
+      inline AnyCellArray() : mySize( 0 ) {}
+      inline Iterator begin()                { return myCells; }
+      inline Iterator end()                  { return myCells + mySize; }
+      inline ConstIterator begin() const     { return myCells; }
+      inline ConstIterator end() const       { return myCells + mySize; }
+      inline SizeType size() const           { return mySize; }
+      inline bool empty() const              { return mySize == 0; }
+      inline void clear()                    { mySize = 0; }
+      inline CellType & operator[]( SizeType i )
+      { ASSERT( i < mySize ); return myCells[ i ]; }
+      inline const CellType & operator[]( SizeType i ) const
+      { ASSERT( i < mySize ); return myCells[ i ]; }
+      inline void push_back( const CellType & c )
+      { ASSERT( mySize < capacity ); myCells[ mySize++ ] = c; }
+
+    private:
+      CellType myCells[ capacity ];
+      SizeType mySize;
+    };
+
+    typedef KhalimskyLocalSizes<dim> LocalSizes;
+    // Fixed-capacity neighborhoods, incident cells, faces and cofaces.
+    typedef AnyCellArray<Cell, LocalSizes::NEIGHBORHOOD> NeighborhoodCells;
+    typedef AnyCellArray<SCell, LocalSizes::NEIGHBORHOOD> NeighborhoodSCells;
+    typedef AnyCellArray<Cell, LocalSizes::INCIDENCE> IncidentCells;
+    typedef AnyCellArray<SCell, LocalSizes::INCIDENCE> IncidentSCells;
+    typedef AnyCellArray<Cell, LocalSizes::CLOSURE - 1> FaceCells;
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -544,6 +607,14 @@ namespace DGtal
        @return the upper bound for digital points in this space.
     */
     const Point & upperBound() const;
+    /**
+       @return the cell of minimal Khalimsky coordinates in this space.
+    */
+    const Cell & lowerCell() const;
+    /**
+       @return the cell of maximal Khalimsky coordinates in this space.
+    */
+    const Cell & upperCell() const;
 
     // ----------------------- Cell creation services --------------------------
   public:
@@ -1341,6 +1412,42 @@ namespace DGtal
     */
     SCells sProperNeighborhood( const SCell & cell ) const;
 
+    /**
+       Allocation-free version of uNeighborhood( const Cell & ).
+       
+       @param cell the unsigned cell of interest.
+       @param N (output) cleared, then filled with the cells of the
+       1-neighborhood of [cell].
+    */
+    void uNeighborhood( const Cell & cell, NeighborhoodCells & N ) const;
+
+    /**
+       Allocation-free version of sNeighborhood( const SCell & ).
+       
+       @param cell the signed cell of interest.
+       @param N (output) cleared, then filled with the cells of the
+       1-neighborhood of [cell].
+    */
+    void sNeighborhood( const SCell & cell, NeighborhoodSCells & N ) const;
+
+    /**
+       Allocation-free version of uProperNeighborhood( const Cell & ).
+       
+       @param cell the unsigned cell of interest.
+       @param N (output) cleared, then filled with the cells of the
+       proper 1-neighborhood of [cell].
+    */
+    void uProperNeighborhood( const Cell & cell, NeighborhoodCells & N ) const;
+
+    /**
+       Allocation-free version of sProperNeighborhood( const SCell & ).
+       
+       @param cell the signed cell of interest.
+       @param N (output) cleared, then filled with the cells of the
+       proper 1-neighborhood of [cell].
+    */
+    void sProperNeighborhood( const SCell & cell, NeighborhoodSCells & N ) const;
+
     /**
        NB: you can go out of the space.
        @param p any cell.
@@ -1448,6 +1555,61 @@ namespace DGtal
     */
     Cells uCoFaces( const Cell & c ) const;
 
+    /**
+       Allocation-free version of uLowerIncident( const Cell & ).
+       @param c any unsigned cell.
+       @param N (output) cleared, then filled with the cells directly
+       low incident to c in this space.
+    */
+    void uLowerIncident( const Cell & c, IncidentCells & N ) const;
+
+    /**
+       Allocation-free version of uUpperIncident( const Cell & ).
+       @param c any unsigned cell.
+       @param N (output) cleared, then filled with the cells directly
+       up incident to c in this space.
+    */
+    void uUpperIncident( const Cell & c, IncidentCells & N ) const;
+
+    /**
+       Allocation-free version of sLowerIncident( const SCell & ).
+       @param c any signed cell.
+       @param N (output) cleared, then filled with the signed cells
+       directly low incident to c in this space.
+    */
+    void sLowerIncident( const SCell & c, IncidentSCells & N ) const;
+
+    /**
+       Allocation-free version of sUpperIncident( const SCell & ).
+       @param c any signed cell.
+       @param N (output) cleared, then filled with the signed cells
+       directly up incident to c in this space.
+    */
+    void sUpperIncident( const SCell & c, IncidentSCells & N ) const;
+
+    /**
+       Allocation-free version of uFaces( const Cell & ). The faces
+       are enumerated by letting each open coordinate of [c] vary in
+       {-1,0,+1}, hence there are exactly 3^k-1 of them for a
+       k-cell.
+
+       @param c any unsigned cell.
+       @param N (output) cleared, then filled with the proper faces
+       of [c].
+    */
+    void uFaces( const Cell & c, FaceCells & N ) const;
+
+    /**
+       Allocation-free version of uCoFaces( const Cell & ). The
+       cofaces are enumerated by letting each closed coordinate of
+       [c] vary in {-1,0,+1}, within the bounds of this space.
+
+       @param c any unsigned cell.
+       @param N (output) cleared, then filled with the proper cofaces
+       of [c].
+    */
+    void uCoFaces( const Cell & c, FaceCells & N ) const;
+
     /**
        Return 'true' if the direct orientation of [p] along [k] is in
        the positive coordinate direction. The direct orientation in a
@@ -1533,6 +1695,22 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+       Appends to [N] all the cells obtained from [c] by adding to
+       each coordinate dirs[j] an offset in [low[j],up[j]], except [c]
+       itself. Used by the allocation-free uFaces and uCoFaces.
+
+       @param c any unsigned cell.
+       @param dirs the m coordinates that vary.
+       @param low the lowest offsets (-1 or 0).
+       @param up the highest offsets (0 or 1).
+       @param m the number of coordinates that vary.
+       @param N (modified) the collection where cells are appended.
+    */
+    void uAddLocalCells( const Cell & c, const Dimension* dirs,
+			 const int* low, const int* up, Dimension m,
+			 FaceCells & N ) const;
+
   }; // end of class KhalimskySpaceND
 
 
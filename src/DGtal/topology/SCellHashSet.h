@@ -0,0 +1,338 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SCellHashSet.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/11
+ *
+ * Header file for module SCellHashSet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SCellHashSet_RECURSES)
+#error Recursive header files inclusion detected in SCellHashSet.h
+#else // defined(SCellHashSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SCellHashSet_RECURSES
+
+#if !defined SCellHashSet_h
+/** Prevents repeated inclusion of headers. */
+#define SCellHashSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskyCellCoder.h"
+#include "DGtal/topology/CodeHashTable.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SCellHashSet
+  /**
+     Description of template class 'SCellHashSet' <p> \brief Aim:
+     A set of signed cells of a cellular grid space, stored as an
+     open-addressing hash table of cell codes (see
+     KhalimskyCellCoder). It is the default container of surfels in
+     Surfaces, since boundary tracking mostly checks whether a
+     neighboring surfel has already been visited.
+
+     Each cell takes 8 bytes and there is no allocation per element,
+     so that it is much more compact and faster than a std::set of
+     cells. The codes are stored in a CodeHashTable, which uses
+     linear probing, a power-of-two capacity kept at most half full,
+     and backward shift deletion.
+
+     It follows the interface of std::set for the services used by
+     the algorithms of Surfaces (insert, find, count, erase, clear,
+     size, iteration), but the elements are visited in no particular
+     order and the iterators dereference to cells by value. Any
+     insertion may invalidate iterators.
+
+     The set must be initialized with the space of its cells, whose
+     codes must fit in 64 bits (see KhalimskyCellCoder::isValid).
+
+     @tparam TKSpace the type of cellular grid space, a model of
+     CCellularGridSpaceND like KhalimskySpaceND.
+
+     @code
+     SCellHashSet<KSpace> surface( K );
+     Surfaces<KSpace>::trackBoundary( surface, K, SAdj, pp, bel );
+     if ( surface.find( other_bel ) != surface.end() ) ...
+     @endcode
+  */
+  template <typename TKSpace>
+  class SCellHashSet
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell SCell;
+    typedef KhalimskyCellCoder<KSpace> Coder;
+    typedef typename Coder::Code Code;
+    typedef CodeHashTable<Coder> Table;
+    typedef typename Table::Size Size;
+    typedef SCell Value;
+    // Types for compatibility with STL containers.
+    typedef SCell value_type;
+    typedef SCell key_type;
+    typedef Size size_type;
+
+    /**
+       Read-only forward iterator on the cells of the set. It
+       dereferences to the cell by value.
+    */
+    class ConstIterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef SCell value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const SCell* pointer;
+      typedef SCell reference;
+
+      ConstIterator() : mySet( 0 ), myIndex( 0 ) {}
+      ConstIterator( const SCellHashSet* set, Size index )
+	: mySet( set ), myIndex( index ) {}
+
+      /// @return the cell pointed by the iterator.
+      SCell operator*() const
+      { return mySet->myCoder.sCell( mySet->myTable.code( myIndex ) ); }
+
+      /// @return the code of the cell pointed by the iterator.
+      Code code() const
+      { return mySet->myTable.code( myIndex ); }
+
+      ConstIterator & operator++()
+      {
+	myIndex = mySet->myTable.nextUsedSlot( myIndex + 1 );
+	return *this;
+      }
+      ConstIterator operator++( int )
+      {
+	ConstIterator tmp( *this );
+	++( *this );
+	return tmp;
+      }
+      bool operator==( const ConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+      bool operator!=( const ConstIterator & other ) const
+      { return myIndex != other.myIndex; }
+
+    private:
+      /// The visited set.
+      const SCellHashSet* mySet;
+      /// The index of the current slot.
+      Size myIndex;
+    };
+    typedef ConstIterator Iterator;
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~SCellHashSet();
+
+    /**
+     * Constructor. The set is not valid until init is called.
+     */
+    SCellHashSet();
+
+    /**
+     * Constructor of an empty set of cells of the space [K].
+     *
+     * @param K any cellular grid space whose cells fit in a code.
+     * @param n the expected number of elements.
+     */
+    SCellHashSet( const KSpace & K, Size n = 0 );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    SCellHashSet( const SCellHashSet & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    SCellHashSet & operator=( const SCellHashSet & other );
+
+    /**
+     * Empties the set and makes it a set of cells of the space [K].
+     *
+     * @param K any cellular grid space.
+     * @return 'true' if the cells of [K] fit in a code, 'false' otherwise.
+     */
+    bool init( const KSpace & K );
+
+    /**
+     * @return the coder of the cells of the set.
+     */
+    const Coder & coder() const;
+
+    /**
+     * Swaps the content of 'this' and [other] in constant time.
+     * @param other any other set.
+     */
+    void swap( SCellHashSet & other );
+
+    // ----------------------- Set services -----------------------------------
+  public:
+
+    /// @return the number of cells in the set.
+    Size size() const;
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const;
+
+    /// @return the number of slots of the table.
+    Size capacity() const;
+
+    /**
+     * Empties the set, but keeps its capacity.
+     */
+    void clear();
+
+    /**
+     * Makes room for [n] cells without rehashing.
+     * @param n any number of cells.
+     */
+    void reserve( Size n );
+
+    /**
+     * Inserts a cell.
+     * @param c any signed cell of the space.
+     * @return an iterator on the cell in the set and 'true' iff the
+     * cell was not already in the set.
+     */
+    std::pair<Iterator,bool> insert( const SCell & c );
+
+    /**
+     * Inserts a range of cells.
+     * @tparam InputIterator any model of input iterator on SCell.
+     * @param it an iterator on the first cell to insert.
+     * @param itE an iterator after the last cell to insert.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator it, InputIterator itE );
+
+    /**
+     * Inserts a cell given by its code.
+     * @param code the code of a signed cell of the space.
+     * @return 'true' iff the cell was not already in the set.
+     */
+    bool insertCode( Code code );
+
+    /**
+     * @param c any signed cell of the space.
+     * @return an iterator on [c] if it belongs to the set, end() otherwise.
+     */
+    ConstIterator find( const SCell & c ) const;
+
+    /**
+     * @param c any signed cell of the space.
+     * @return 1 if [c] belongs to the set, 0 otherwise.
+     */
+    Size count( const SCell & c ) const;
+
+    /**
+     * @param code the code of a signed cell of the space.
+     * @return 'true' iff this cell belongs to the set.
+     */
+    bool containsCode( Code code ) const;
+
+    /**
+     * Removes a cell from the set.
+     * @param c any signed cell of the space.
+     * @return the number of removed cells (0 or 1).
+     */
+    Size erase( const SCell & c );
+
+    /// @return an iterator on the first cell of the set.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last cell of the set.
+    ConstIterator end() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is initialized with a space whose
+     * cells fit in a code.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Encodes and decodes the cells.
+    Coder myCoder;
+    /// The table of codes.
+    Table myTable;
+
+    friend class ConstIterator;
+
+  }; // end of class SCellHashSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SCellHashSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SCellHashSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SCellHashSet<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SCellHashSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SCellHashSet_h
+
+#undef SCellHashSet_RECURSES
+#endif // else defined(SCellHashSet_RECURSES)
@@ -0,0 +1,283 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfelGraph.h
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/17
+ *
+ * Header file for module SurfelGraph.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfelGraph_RECURSES)
+#error Recursive header files inclusion detected in SurfelGraph.h
+#else // defined(SurfelGraph_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfelGraph_RECURSES
+
+#if !defined SurfelGraph_h
+/** Prevents repeated inclusion of headers. */
+#define SurfelGraph_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/KhalimskyCellCoder.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfelGraph
+  /**
+     Description of template class 'SurfelGraph' <p> \brief Aim:
+     The adjacency graph of a set of surfels, stored in compressed
+     sparse row format, i.e. as flat arrays of integers.
+
+     Surfels are numbered from 0 to size()-1 by increasing code (see
+     KhalimskyCellCoder). The neighbors of surfel i are the indices
+     neighbors()[ offsets()[ i ] ] to neighbors()[ offsets()[ i+1 ]-1 ].
+     Algorithms iterating many times over the same surface (smoothing,
+     diffusion, geodesics) can thus work on arrays indexed by surfels
+     without building any cell.
+
+     The neighbor of a surfel s along a tracking direction is the
+     first follower of s that belongs to the set, the followers being
+     checked in the order given by the surfel adjacency (interior
+     first, or exterior first). It is the surfel given by
+     SurfelNeighborhood::getAdjacentOnPointPredicate when the set is
+     the boundary of the shape. Neighbors are listed in the order of
+     the tracking directions of s, in positive then negative
+     direction, as in ImplicitDigitalSurface::neighbors.
+
+     The graph is computed in parallel when OpenMP is enabled: each
+     surfel looks for its followers by binary search among the sorted
+     codes.
+
+     @tparam TKSpace the type of cellular grid space, a model of
+     CCellularGridSpaceND like KhalimskySpaceND.
+
+     @code
+     std::vector<SCell> bdry;
+     Surfaces<KSpace>::sMakeBoundaryParallel( bdry, K, pp, low, up );
+     SurfelGraph<KSpace> graph;
+     graph.init( K, SurfelAdjacency<3>( true ), bdry.begin(), bdry.end() );
+     for ( SurfelGraph<KSpace>::Index i = 0; i < graph.size(); ++i )
+       for ( const SurfelGraph<KSpace>::Index* it = graph.neighborsBegin( i ),
+               * itE = graph.neighborsEnd( i ); it != itE; ++it )
+         ...
+     @endcode
+  */
+  template <typename TKSpace>
+  class SurfelGraph
+  {
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::SCell Surfel;
+    typedef typename KSpace::DirIterator DirIterator;
+    typedef SurfelAdjacency<KSpace::dimension> Adjacency;
+    typedef KhalimskyCellCoder<KSpace> Coder;
+    typedef typename Coder::Code Code;
+    /// The type of surfel indices and offsets.
+    typedef DGtal::uint32_t Index;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~SurfelGraph();
+
+    /**
+     * Constructor of an empty graph.
+     */
+    SurfelGraph();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    SurfelGraph( const SurfelGraph & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    SurfelGraph & operator=( const SurfelGraph & other );
+
+    /**
+     * Builds the graph of a set of surfels. Duplicated surfels are
+     * kept once.
+     *
+     * @tparam SCellConstIterator any model of forward iterator on SCell.
+     *
+     * @param K any cellular grid space whose cells fit in a code.
+     * @param adj the surfel adjacency linking surfels.
+     * @param itB an iterator on the first surfel.
+     * @param itE an iterator after the last surfel.
+     *
+     * @throw InputException if the cells of [K] do not fit in a code.
+     */
+    template <typename SCellConstIterator>
+    void init( const KSpace & K, const Adjacency & adj,
+	       SCellConstIterator itB, SCellConstIterator itE )
+      throw( DGtal::InputException );
+
+    /**
+     * Empties the graph.
+     */
+    void clear();
+
+    // ----------------------- Graph services ---------------------------------
+  public:
+
+    /// @return the number of surfels.
+    Index size() const;
+
+    /// @return the number of arcs, i.e. twice the number of edges
+    /// when the adjacency is symmetric.
+    Index nbArcs() const;
+
+    /**
+     * @param i any surfel index.
+     * @return the surfel of index [i].
+     */
+    SCell surfel( Index i ) const;
+
+    /**
+     * @param i any surfel index.
+     * @return the code of the surfel of index [i].
+     */
+    Code code( Index i ) const;
+
+    /**
+     * @param s any signed surfel.
+     * @return the index of [s], or size() if [s] is not in the graph.
+     */
+    Index index( const SCell & s ) const;
+
+    /**
+     * @param i any surfel index.
+     * @return the number of neighbors of surfel [i].
+     */
+    Index degree( Index i ) const;
+
+    /**
+     * @param i any surfel index.
+     * @return a pointer on the first neighbor index of surfel [i].
+     */
+    const Index* neighborsBegin( Index i ) const;
+
+    /**
+     * @param i any surfel index.
+     * @return a pointer after the last neighbor index of surfel [i].
+     */
+    const Index* neighborsEnd( Index i ) const;
+
+    /// @return the array of size size()+1 of the offsets of the
+    /// neighbors of each surfel in neighbors().
+    const std::vector<Index> & offsets() const;
+
+    /// @return the array of the neighbor indices of all the surfels.
+    const std::vector<Index> & neighbors() const;
+
+    /// @return the array of the codes of the surfels, sorted.
+    const std::vector<Code> & codes() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Encodes and decodes the surfels.
+    Coder myCoder;
+    /// The sorted codes of the surfels.
+    std::vector<Code> myCodes;
+    /// The offsets of the neighbors of each surfel in myNeighbors.
+    std::vector<Index> myOffsets;
+    /// The neighbors of all the surfels.
+    std::vector<Index> myNeighbors;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param K the space of the surfels.
+       @param SN a neighborhood set on some surfel.
+       @param adj the surfel adjacency.
+       @param track_dir a tracking direction of the surfel.
+       @param pos the orientation along [track_dir].
+       @return the index of the neighbor of the surfel of [SN] in the
+       given direction, or size() if there is none.
+    */
+    Index follower( const KSpace & K, const SurfelNeighborhood<KSpace> & SN,
+		    const Adjacency & adj,
+		    Dimension track_dir, bool pos ) const;
+
+  }; // end of class SurfelGraph
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfelGraph'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfelGraph' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfelGraph<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/SurfelGraph.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfelGraph_h
+
+#undef SurfelGraph_RECURSES
+#endif // else defined(SurfelGraph_RECURSES)
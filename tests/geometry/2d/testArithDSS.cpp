@@ -37,6 +37,7 @@
 #include <iostream>
 #include <iterator>
 #include <cstdio>
+#include <cstdlib>
 #include <cmath>
 #include <fstream>
 #include <vector>
@@ -46,7 +47,13 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/2d/ArithmeticalDSS.h"
+#include "DGtal/geometry/2d/ChainCodeDSS.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+#include "DGtal/io/readers/PointListReader.h"
 #include "DGtal/io/boards/Board2D.h"
+#include "DGtal/utils/Clock.h"
+
+#include "ConfigTest.h"
 
 #ifdef WITH_GMP
 #include <gmpxx.h>
@@ -421,6 +428,198 @@ bool testSmartDSS()
   return true;  
 }
 
+/**
+ * @return the points of the chain code [codes] (4- or 8-connected),
+ * starting at (x0,y0).
+ */
+template <int connectivity>
+std::vector< PointVector<2,int> >
+chainCodePoints( const std::string & codes, int x0, int y0 )
+{
+  typedef PointVector<2,int> Point;
+  std::vector<Point> points;
+  Point p( x0, y0 );
+  points.push_back( p );
+  for ( unsigned int i = 0; i < codes.size(); ++i )
+    {
+      p += ChainCodeDSS<int,connectivity>::step( codes[ i ] - '0' );
+      points.push_back( p );
+    }
+  return points;
+}
+
+/**
+ * @return a pseudo-random chain code of [n] codes, made of long
+ * almost straight parts.
+ */
+template <int connectivity>
+std::string
+randomChainCode( unsigned int n )
+{
+  std::string codes;
+  unsigned int c = 0;
+  unsigned int other = 1;
+  for ( unsigned int i = 0; i < n; ++i )
+    {
+      int r = rand() % 64;
+      if ( r == 0 )
+	{ // turn
+	  c = ( c + 1 ) % connectivity;
+	  other = ( rand() % 2 ) ? ( c + 1 ) % connectivity
+	    : ( c + connectivity - 1 ) % connectivity;
+	}
+      codes.push_back( '0' + ( ( r % 5 == 0 ) ? other : c ) );
+    }
+  return codes;
+}
+
+/**
+ * Compares the longest DSS read from some positions of [codes] by
+ * ChainCodeDSS and by ArithmeticalDSS.
+ */
+template <int connectivity>
+bool compareChainCodeDSS( const std::string & codes, int x0, int y0,
+			  unsigned int stride )
+{
+  typedef PointVector<2,int> Point;
+  typedef std::vector<Point>::const_iterator ConstIterator;
+  typedef ArithmeticalDSS<ConstIterator,int,connectivity> DSS;
+  typedef ChainCodeDSS<int,connectivity> CDSS;
+
+  std::vector<Point> points = chainCodePoints<connectivity>( codes, x0, y0 );
+  std::vector<typename CDSS::Size> positions;
+  std::vector<typename CDSS::Size> lengths;
+  bool ok = true;
+  CDSS cdss;
+  for ( unsigned int i = 0; ok && ( i < codes.size() ); i += stride )
+    {
+      DSS dss;
+      ConstIterator it = points.begin() + i;
+      dss.init( it );
+      ++it;
+      while ( ( it != points.end() ) && dss.extend( it ) )
+	++it;
+      unsigned int n = cdss.longestPrefix( points[ i ], codes, i );
+      ok = ( n == (unsigned int) ( dss.getFront() - dss.getBack() ) )
+	&& ( cdss.getA() == dss.getA() ) && ( cdss.getB() == dss.getB() )
+	&& ( cdss.getMu() == dss.getMu() ) && ( cdss.getOmega() == dss.getOmega() )
+	&& ( cdss.getUf() == dss.getUf() ) && ( cdss.getUl() == dss.getUl() )
+	&& ( cdss.getLf() == dss.getLf() ) && ( cdss.getLl() == dss.getLl() )
+	&& ( cdss.getFrontPoint() == *dss.getFront() )
+	&& cdss.isValid();
+      if ( ! ok )
+	trace.info() << "at " << i << ": " << cdss << " != " << dss << std::endl;
+      positions.push_back( i );
+      lengths.push_back( n );
+    }
+  std::vector<typename CDSS::Size> bulkLengths;
+  CDSS::longestPrefixes( codes, false, positions, bulkLengths );
+  return ok && ( bulkLengths == lengths );
+}
+
+/**
+ * Checks that ChainCodeDSS computes the same DSS as ArithmeticalDSS
+ * on chain codes.
+ */
+bool testChainCodeDSS()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock( "Comparing ChainCodeDSS with ArithmeticalDSS ..." );
+  std::string files[] = { "samples/freemanChainSample.fc",
+			  "samples/contourS.fc",
+			  "samples/klokan.fc" };
+  for ( unsigned int f = 0; f < 3; ++f )
+    {
+      std::vector< FreemanChain<int> > chains =
+	PointListReader< PointVector<2,int> >::
+	getFreemanChainsFromFile<int>( testPath + files[ f ] );
+      for ( unsigned int i = 0; i < chains.size(); ++i )
+	{
+	  nbok += compareChainCodeDSS<4>( chains[ i ].chain,
+					  chains[ i ].x0, chains[ i ].y0, 1 ) ? 1 : 0;
+	  nb++;
+	  trace.info() << "(" << nbok << "/" << nb << ") "
+		       << files[ f ] << " " << i << std::endl;
+	}
+    }
+  srand( 0 );
+  nbok += compareChainCodeDSS<4>( randomChainCode<4>( 20000 ), 5, -3, 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") random 4-connected" << std::endl;
+  nbok += compareChainCodeDSS<8>( randomChainCode<8>( 20000 ), -7, 2, 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") random 8-connected" << std::endl;
+
+  // Closed curve: the longest DSS from the last code goes on
+  // with the first codes, and never reads more than all the codes.
+  ChainCodeDSS<int,4> dss;
+  nbok += ( dss.longestPrefix( PointVector<2,int>( 0, 0 ), "0121", 3, true ) == 3 )
+    && ( dss.longestPrefix( PointVector<2,int>( 0, 0 ), "0011", 3, true ) == 4 )
+    && ( dss.longestPrefix( PointVector<2,int>( 0, 0 ), "0000", 1, true ) == 4 )
+    && ( dss.longestPrefix( PointVector<2,int>( 0, 0 ), "0000", 1, false ) == 3 )
+    && ( dss.longestPrefix( PointVector<2,int>( 0, 0 ), "02", 0, false ) == 1 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") closed curves" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Times the computation of the longest DSS from every position of a
+ * long chain code, with ArithmeticalDSS and ChainCodeDSS.
+ */
+template <int connectivity>
+bool benchmarkChainCodeDSS()
+{
+  typedef PointVector<2,int> Point;
+  typedef std::vector<Point>::const_iterator ConstIterator;
+  typedef ArithmeticalDSS<ConstIterator,int,connectivity> DSS;
+  typedef ChainCodeDSS<int,connectivity> CDSS;
+
+  trace.beginBlock( "Benchmarking ChainCodeDSS against ArithmeticalDSS ..." );
+  srand( 1 );
+  std::string codes = randomChainCode<connectivity>( 200000 );
+  std::vector<Point> points = chainCodePoints<connectivity>( codes, 0, 0 );
+  Clock c;
+  long total1 = 0;
+  c.startClock();
+  for ( unsigned int i = 0; i < codes.size(); ++i )
+    {
+      DSS dss;
+      ConstIterator it = points.begin() + i;
+      dss.init( it );
+      ++it;
+      while ( ( it != points.end() ) && dss.extend( it ) )
+	++it;
+      total1 += dss.getFront() - dss.getBack();
+    }
+  double t1 = c.stopClock();
+  long total2 = 0;
+  c.startClock();
+  CDSS cdss;
+  for ( unsigned int i = 0; i < codes.size(); ++i )
+    total2 += cdss.longestPrefix( points[ i ], codes, i );
+  double t2 = c.stopClock();
+  std::vector<typename CDSS::Size> positions( codes.size() );
+  std::vector<typename CDSS::Size> lengths;
+  for ( unsigned int i = 0; i < codes.size(); ++i )
+    positions[ i ] = i;
+  c.startClock();
+  CDSS::longestPrefixes( codes, false, positions, lengths );
+  double t3 = c.stopClock();
+  long total3 = 0;
+  for ( unsigned int i = 0; i < lengths.size(); ++i )
+    total3 += lengths[ i ];
+  trace.info() << connectivity << "-connected, " << codes.size()
+	       << " starting positions, " << total1 << " points added" << std::endl;
+  trace.info() << "ArithmeticalDSS::extend " << t1 << " ms" << std::endl;
+  trace.info() << "ChainCodeDSS::extend    " << t2 << " ms" << std::endl;
+  trace.info() << "ChainCodeDSS::longestPrefixes " << t3 << " ms" << std::endl;
+  trace.endBlock();
+  return ( total1 == total2 ) && ( total1 == total3 );
+}
+
 int main(int argc, char **argv)
 {
 
@@ -438,6 +637,9 @@ int main(int argc, char **argv)
 					&& testGMP()
 #endif
          && testSmartDSS()
+         && testChainCodeDSS()
+         && benchmarkChainCodeDSS<4>()
+         && benchmarkChainCodeDSS<8>()
     ;
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
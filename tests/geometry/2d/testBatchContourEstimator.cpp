@@ -0,0 +1,216 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchContourEstimator.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/23
+ *
+ * Functions for testing class BatchContourEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+#include "DGtal/geometry/2d/ArithmeticalDSS.h"
+#include "DGtal/geometry/2d/SegmentComputerFunctor.h"
+#include "DGtal/geometry/2d/MostCenteredMaximalSegmentEstimator.h"
+#include "DGtal/geometry/2d/BinomialConvolver.h"
+#include "DGtal/geometry/2d/estimators/BatchContourEstimator.h"
+#include "DGtal/io/readers/PointListReader.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef int Integer;
+typedef FreemanChain<Integer> Contour;
+typedef PointVector<2,Integer> Point;
+typedef std::vector<Point> Storage;
+typedef Storage::const_iterator ConstIteratorOnPoints;
+
+typedef BinomialConvolver<ConstIteratorOnPoints, double> MyBinomialConvolver;
+typedef CurvatureFromBinomialConvolverFunctor< MyBinomialConvolver, double >
+CurvatureBCFct;
+typedef BinomialConvolverEstimator< MyBinomialConvolver, CurvatureBCFct> 
+BCCurvatureEstimator;
+
+typedef ArithmeticalDSS<ConstIteratorOnPoints,Integer,4> SegmentComputer;
+typedef CurvatureFromDSSLengthFunctor<SegmentComputer> MSFunctor;
+typedef MostCenteredMaximalSegmentEstimator<SegmentComputer,MSFunctor> 
+MSCurvatureEstimator;
+
+/**
+ * Evaluates [Estimator] on each contour separately, as the tools did.
+ */
+template <typename Estimator>
+void evalOneByOne( std::vector<double> & values,
+		   const std::vector<Contour> & chains, 
+		   bool removeLastPointIfClosed )
+{
+  values.clear();
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    {
+      Storage points;
+      Contour::getContourPoints( chains[ i ], points );
+      bool isClosed = chains[ i ].isClosed();
+      if ( isClosed && removeLastPointIfClosed ) points.pop_back();
+      Estimator estimator;
+      estimator.init( 1.0, points.begin(), points.end(), isClosed );
+      std::vector<double> v( points.size() );
+      estimator.eval( points.begin(), points.end(), v.begin() );
+      values.insert( values.end(), v.begin(), v.end() );
+    }
+}
+
+/**
+ * Checks the values given by evalStream against the expected ones.
+ */
+struct CheckVisitor
+{
+  const std::vector<double> & myExpected;
+  std::size_t myPos;
+  std::size_t myIndex;
+  bool myOK;
+
+  CheckVisitor( const std::vector<double> & expected )
+    : myExpected( expected ), myPos( 0 ), myIndex( 0 ), myOK( true )
+  {}
+
+  void operator()( std::size_t index, const Contour & /* chain */, 
+		   bool /* closed */,
+		   std::vector<double>::const_iterator itb,
+		   std::vector<double>::const_iterator ite )
+  {
+    myOK = myOK && ( index == myIndex++ );
+    for ( ; itb != ite; ++itb )
+      myOK = myOK && ( myPos < myExpected.size() ) 
+	&& ( *itb == myExpected[ myPos++ ] );
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchContourEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the batch evaluation on several contours with the
+ * evaluation contour by contour.
+ */
+template <typename Estimator>
+bool testBatchContourEstimator( const std::vector<Contour> & chains,
+				bool removeLastPointIfClosed )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing batch evaluation ..." );
+  std::vector<double> expected;
+  evalOneByOne<Estimator>( expected, chains, removeLastPointIfClosed );
+
+  BatchContourEstimator<Estimator> batch( 1.0, removeLastPointIfClosed );
+  batch.init( chains );
+  trace.info() << batch << std::endl;
+  nbok += ( batch.isValid() && ( batch.nbContours() == chains.size() )
+	    && ( batch.nbValues() == expected.size() ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << batch.nbValues() << " == " << expected.size() 
+	       << " values." << std::endl;
+  std::vector<double> values( batch.nbValues() );
+  batch.eval( chains, values.begin() );
+  nbok += ( values == expected ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "batch == contour by contour" << std::endl;
+  bool boxes_ok = true;
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    {
+      Storage points;
+      Contour::getContourPoints( chains[ i ], points );
+      Point low = points[ 0 ];
+      Point up = points[ 0 ];
+      for ( unsigned int j = 1; j < points.size(); ++j )
+	{
+	  low = low.inf( points[ j ] );
+	  up = up.sup( points[ j ] );
+	}
+      boxes_ok = boxes_ok && ( batch.lowerBound( i ) == low ) 
+	&& ( batch.upperBound( i ) == up );
+    }
+  nbok += boxes_ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "bounding boxes of the contours" << std::endl;
+
+  // The same contours read from a stream by blocks of 3.
+  std::stringstream ss;
+  ss << "# contours" << std::endl;
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    ss << chains[ i ].x0 << " " << chains[ i ].y0 << " " 
+       << chains[ i ].chain << std::endl;
+  CheckVisitor visitor( expected );
+  BatchContourEstimator<Estimator> sbatch( 1.0, removeLastPointIfClosed );
+  std::size_t n = sbatch.template evalStream<Integer>( ss, visitor, 3 );
+  nbok += ( visitor.myOK && ( n == chains.size() ) 
+	    && ( visitor.myPos == expected.size() ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "stream by blocks == contour by contour" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BatchContourEstimator" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  std::vector<Contour> chains = PointListReader<Point>::
+    getFreemanChainsFromFile<Integer>( testPath + "samples/freemanChainSample.fc" );
+  std::vector<Contour> others = PointListReader<Point>::
+    getFreemanChainsFromFile<Integer>( testPath + "samples/manche.fc" );
+  chains.insert( chains.end(), others.begin(), others.end() );
+  others = PointListReader<Point>::
+    getFreemanChainsFromFile<Integer>( testPath + "samples/contourS.fc" );
+  chains.insert( chains.end(), others.begin(), others.end() );
+
+  bool res = testBatchContourEstimator<BCCurvatureEstimator>( chains, false )
+    && testBatchContourEstimator<MSCurvatureEstimator>( chains, true ); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
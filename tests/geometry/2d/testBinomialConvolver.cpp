@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cmath>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/RealPointVector.h"
 #include "DGtal/geometry/2d/BinomialConvolver.h"
@@ -119,6 +121,65 @@ bool testBinomialConvolver()
   return nbok == nb;
 }
 
+/**
+ * Checks that batch evaluation and initialization from an array give
+ * the same estimations as the evaluation point by point, on a
+ * digitized circle.
+ */
+bool testBinomialConvolverBatch()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing batch evaluation ..." );
+  typedef RealPointVector<2> RealPoint;
+  std::vector< RealPoint > points;
+  const unsigned int nbPts = 2000;
+  for ( unsigned int i = 0; i < nbPts; ++i )
+    {
+      double a = 2.0 * M_PI * (double) i / (double) nbPts;
+      points.push_back( RealPoint( floor( 300.0 * cos( a ) + 0.5 ),
+				   floor( 300.0 * sin( a ) + 0.5 ) ) );
+    }
+  typedef std::vector< RealPoint >::const_iterator ConstIteratorOnPoints;
+  typedef BinomialConvolver<ConstIteratorOnPoints, double> MyBinomialConvolver;
+  typedef CurvatureFromBinomialConvolverFunctor< MyBinomialConvolver, double >
+    CurvatureBCFct;
+  BinomialConvolverEstimator< MyBinomialConvolver, CurvatureBCFct> curvEstimator;
+  curvEstimator.init( 1.0, points.begin(), points.end(), true );
+  std::vector<double> batch( nbPts );
+  curvEstimator.eval( points.begin(), points.end(), batch.begin() );
+  // Starting in the middle of the contour.
+  ConstIteratorOnPoints itm = points.begin();
+  for ( unsigned int i = 0; i < nbPts / 2; ++i ) ++itm;
+  std::vector<double> half( nbPts / 2 );
+  curvEstimator.eval( itm, points.end(), half.begin() );
+
+  MyBinomialConvolver bc( MyBinomialConvolver::suggestedSize
+			  ( 1.0, points.begin(), points.end() ) );
+  bc.init( 1.0, &points[ 0 ], nbPts, true );
+  unsigned int nbSame = 0;
+  unsigned int i = 0;
+  for ( ConstIteratorOnPoints it = points.begin(); it != points.end(); ++it, ++i )
+    {
+      double k = curvEstimator.eval( it );
+      nbSame += ( ( k == batch[ i ] ) 
+		  && ( ( i < nbPts / 2 ) || ( k == half[ i - nbPts / 2 ] ) )
+		  && ( std::abs( k - bc.curvature( i ) ) < 1e-12 ) ) ? 1 : 0;
+    }
+  nbok += ( nbSame == nbPts ) && ( bc.nbPoints() == nbPts ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << nbSame << "/" << nbPts << " same curvatures." << std::endl;
+  nbok += ( std::abs( 300.0 * batch[ 0 ] - 1.0 ) < 0.1 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "curvature " << batch[ 0 ] << " ~ 1/300." << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -130,7 +191,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testBinomialConvolver(); // && ... other tests
+  bool res = testBinomialConvolver() && testBinomialConvolverBatch(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
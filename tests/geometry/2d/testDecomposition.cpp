@@ -49,6 +49,8 @@
 #include "DGtal/geometry/2d/ArithmeticalDSS.h"
 #include "DGtal/geometry/2d/FreemanChain.h"
 #include "DGtal/geometry/2d/GreedyDecomposition.h"
+#include "DGtal/geometry/2d/FlatGreedyDecomposition.h"
+#include "DGtal/io/readers/PointListReader.h"
 
 
 #include "ConfigTest.h"
@@ -614,6 +616,125 @@ curve.push_back(Point(9,1));
 	return (compteur==2);
 }
 
+/**
+ * @return 'true' if FlatGreedyDecomposition and GreedyDecomposition
+ * give the same segments on [itb,ite).
+ */
+template <typename DSS>
+bool sameDecomposition( const typename DSS::ConstIterator & itb,
+			const typename DSS::ConstIterator & ite,
+			bool isClosed )
+{
+  typedef GreedyDecomposition<DSS> Decomposition;
+  Decomposition dec( itb, ite, DSS(), isClosed );
+  FlatGreedyDecomposition<DSS> flat;
+  flat.compute( itb, ite, DSS(), isClosed );
+  bool ok = flat.isValid();
+  unsigned int i = 0;
+  for ( typename Decomposition::SegmentIterator it = dec.begin();
+	ok && ( it != dec.end() ); ++it, ++i )
+    ok = ( i < flat.size() )
+      && ( (unsigned int) std::distance( itb, it.getBack() ) == flat.back( i ) )
+      && ( (unsigned int) std::distance( itb, it.getFront() ) == flat.front( i ) )
+      && ( it.intersectNext() == flat.intersectNext( i ) )
+      && ( it.intersectPrevious() == flat.intersectPrevious( i ) )
+      && ( *it == flat.segment( i ) );
+  return ok && ( i == flat.size() );
+}
+
+/**
+ * Test for FlatGreedyDecomposition, compared with GreedyDecomposition.
+ *
+ */
+bool testFlatGreedyDecomposition()
+{
+  typedef PointVector<2,int> Point;
+  typedef std::vector<Point> Sequence;
+  typedef ArithmeticalDSS<Sequence::const_iterator,int,4> DSS4;
+  typedef ArithmeticalDSS<Sequence::const_iterator,int,8> DSS8;
+  typedef FreemanChain<int> Contour4;
+  typedef ArithmeticalDSS<Contour4::ConstIterator,int,4> FDSS4;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Test for FlatGreedyDecomposition" );
+  const char* files[] = { "samples/freemanChainSample.fc",
+			  "samples/contourS.fc", "samples/klokan.fc" };
+  for ( unsigned int f = 0; f < 3; ++f )
+    {
+      std::vector<Contour4> chains = PointListReader<Point>::
+	getFreemanChainsFromFile<int>( testPath + files[ f ] );
+      for ( unsigned int i = 0; i < chains.size(); ++i )
+	{
+	  Sequence points;
+	  Contour4::getContourPoints( chains[ i ], points );
+	  nbok += sameDecomposition<DSS4>( points.begin(), points.end(), false ) ? 1 : 0;
+	  nb++;
+	  if ( chains[ i ].isClosed() ) points.pop_back();
+	  nbok += sameDecomposition<DSS4>( points.begin(), points.end(), true ) ? 1 : 0;
+	  nb++;
+	  nbok += sameDecomposition<FDSS4>( chains[ i ].begin(), chains[ i ].end(),
+					    true ) ? 1 : 0;
+	  nb++;
+	  trace.info() << "(" << nbok << "/" << nb << ") "
+		       << files[ f ] << " " << i << std::endl;
+	}
+    }
+
+  // Disconnected, 8-connected, and very small curves.
+  Sequence curve;
+  curve.push_back(Point(-1,-1));
+  curve.push_back(Point(0,0));
+  curve.push_back(Point(1,0));
+  curve.push_back(Point(1,1));
+  curve.push_back(Point(2,1));
+  curve.push_back(Point(3,2));
+  curve.push_back(Point(4,2));
+  curve.push_back(Point(5,2));
+  curve.push_back(Point(6,2));
+  curve.push_back(Point(6,3));
+  curve.push_back(Point(7,4));
+  curve.push_back(Point(9,3));
+  curve.push_back(Point(10,2));
+  nbok += sameDecomposition<DSS4>( curve.begin(), curve.end(), false ) ? 1 : 0;
+  nb++;
+  nbok += sameDecomposition<DSS4>( curve.begin(), curve.end(), true ) ? 1 : 0;
+  nb++;
+  nbok += sameDecomposition<DSS8>( curve.begin(), curve.end(), false ) ? 1 : 0;
+  nb++;
+  nbok += sameDecomposition<DSS8>( curve.begin(), curve.end(), true ) ? 1 : 0;
+  nb++;
+  for ( unsigned int n = 0; n < 3; ++n )
+    {
+      nbok += sameDecomposition<DSS4>( curve.begin(), curve.begin() + n, false )
+	&& sameDecomposition<DSS4>( curve.begin(), curve.begin() + n, true ) ? 1 : 0;
+      nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") small curves" << std::endl;
+
+  // A long curve.
+  Sequence circle;
+  int R = 40000;
+  int x = R;
+  int y = 0;
+  for ( double t = 0.0; t < 2.0 * M_PI; t += 1.0 / R )
+    {
+      int nx = (int) floor( R * cos( t ) + 0.5 );
+      int ny = (int) floor( R * sin( t ) + 0.5 );
+      while ( ( x != nx ) || ( y != ny ) )
+	{
+	  if ( x != nx ) x += ( nx > x ) ? 1 : -1;
+	  else y += ( ny > y ) ? 1 : -1;
+	  circle.push_back( Point( x, y ) );
+	}
+    }
+  nbok += sameDecomposition<DSS4>( circle.begin(), circle.end(), true ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") long curve" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -637,7 +758,8 @@ int main(int argc, char **argv)
 					&& testOnePoint()
 					&& testTwoEndIterators()
 					&& testOneDSS()
-					&& testDec8Reverse();
+					&& testDec8Reverse()
+					&& testFlatGreedyDecomposition();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
 
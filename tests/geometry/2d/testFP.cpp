@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <fstream>
+#include <algorithm>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -122,6 +123,98 @@ bool testDrawingFP()
   return true;
 }
 
+/**
+ * Checks the indices of the FP vertices and the MLP vertices, on
+ * open and closed curves, and the reuse of an FP by init.
+ */
+bool testIndicesFP()
+{
+  typedef int Coordinate;
+  typedef PointVector<2,Coordinate> Point;
+  typedef FreemanChain<Coordinate> Contour; 
+  typedef vector<Point>::const_iterator ConstIterator;
+  typedef FP<ConstIterator,Coordinate,4> FP;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  std::string filename = testPath + "samples/contourS.fc";
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  Contour theContour(fst);
+  vector<Point> pts;
+  Contour::getContourPoints( theContour, pts );
+  pts.pop_back(); //the last point is the first one
+
+  trace.beginBlock ( "Indices of the FP vertices..." );
+
+  FP theFP;
+  for (int closed = 0; closed < 2; ++closed) {
+    theFP.init( pts.begin(), pts.end(), closed == 1 );
+    FP otherFP( pts.begin(), pts.end(), closed == 1 );
+
+    const vector<Point> & v = theFP.vertices();
+    const vector<FP::Size> & ind = theFP.indices();
+    bool ok = ( v.size() == theFP.size() ) && ( ind.size() == v.size() ) 
+      && ( v == otherFP.vertices() ) && ( theFP.isClosed() == (closed == 1) );
+    //each vertex is at its index, indices increase circularly
+    unsigned int nbDecreases = 0;
+    for (FP::Size k = 0; ok && k < v.size(); ++k) {
+      ok = ( ind[k] < pts.size() ) && ( pts[ ind[k] ] == v[k] );
+      if ( (k > 0)&&(ind[k] <= ind[k-1]) ) ++nbDecreases;
+    }
+    ok = ok && ( nbDecreases <= (unsigned int) closed );
+    nbok += ok ? 1 : 0; 
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " 
+                 << v.size() << " vertices, closed=" << closed << endl;
+
+    vector<FP::RealPoint> mlp( theFP.size() );
+    theFP.copyMLP( mlp.begin() );
+    ok = true;
+    for (FP::Size k = 0; k < mlp.size(); ++k)
+      ok = ok && ( theFP.mlpVertex( k ) == mlp[k] );
+    nbok += ok ? 1 : 0; 
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") MLP vertices" << endl;
+  }
+
+  //two squares touching at the origin, which is met twice
+  vector<Point> pinched;
+  Point p( 1, 0 );
+  const int moves[ 7 ][ 3 ] = { { 1, 0, 3 }, { 0, 1, 4 }, { -1, 0, 4 }, { 0, -1, 4 },
+                                { -1, 0, 3 }, { 0, -1, 3 }, { 1, 0, 3 } };
+  pinched.push_back( p );
+  for (int m = 0; m < 7; ++m) 
+    for (int k = 0; k < moves[m][2]; ++k) {
+      p += Point( moves[m][0], moves[m][1] );
+      pinched.push_back( p );
+    }
+  for (int k = 0; k < 3; ++k) {
+    p += Point( 0, 1 );
+    pinched.push_back( p );
+  }
+  theFP.init( pinched.begin(), pinched.end(), true );
+  const vector<FP::Size> & ind = theFP.indices();
+  vector<FP::Size> sortedInd( ind );
+  std::sort( sortedInd.begin(), sortedInd.end() );
+  bool ok = std::unique( sortedInd.begin(), sortedInd.end() ) == sortedInd.end();
+  unsigned int nbDecreases = 0;
+  for (FP::Size k = 0; ok && k < ind.size(); ++k) {
+    ok = ( ind[k] < pinched.size() ) && ( pinched[ ind[k] ] == theFP.vertices()[k] );
+    if ( (k > 0)&&(ind[k] <= ind[k-1]) ) ++nbDecreases;
+  }
+  ok = ok && ( nbDecreases <= 1 );
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " 
+               << theFP.size() << " vertices on a pinched curve" << endl;
+
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -133,7 +226,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testDrawingFP(); // && ... other tests
+  bool res = testDrawingFP()
+    && testIndicesFP(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
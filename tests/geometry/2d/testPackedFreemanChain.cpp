@@ -0,0 +1,187 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/25
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+#include "DGtal/geometry/2d/PackedFreemanChain.h"
+#include "DGtal/io/readers/PointListReader.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef int Integer;
+typedef FreemanChain<Integer> Contour;
+typedef PackedFreemanChain<Integer> PackedContour;
+typedef Contour::PointI2 Point;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return 'true' if the packed chain [pfc] gives the same points,
+ * bounding box and closedness as [fc], and the area of its polygon
+ * when it is closed.
+ */
+bool samePackedChain( const Contour & fc )
+{
+  PackedContour pfc( fc );
+  std::vector<Point> points;
+  Contour::getContourPoints( fc, points );
+  std::vector<Point> ppoints;
+  pfc.getContourPoints( ppoints );
+  std::vector<Point> ipoints;
+  for ( PackedContour::ConstIterator it = pfc.begin(), itE = pfc.end();
+	it != itE; ++it )
+    ipoints.push_back( *it );
+  Integer minX, minY, maxX, maxY;
+  Integer pminX, pminY, pmaxX, pmaxY;
+  fc.computeBoundingBox( minX, minY, maxX, maxY );
+  pfc.computeBoundingBox( pminX, pminY, pmaxX, pmaxY );
+  DGtal::int64_t a = 0;
+  for ( unsigned int i = 0; i + 1 < points.size(); ++i )
+    a += (DGtal::int64_t) points[ i ][ 0 ] 
+      * ( points[ i + 1 ][ 1 ] - points[ i ][ 1 ] );
+  Contour fc2;
+  pfc.getFreemanChain( fc2 );
+  return pfc.isValid() && ( pfc.size() == fc.size() )
+    && ( points == ppoints ) && ( points == ipoints )
+    && ( pfc.lastPoint() == points.back() )
+    && ( minX == pminX ) && ( minY == pminY ) 
+    && ( maxX == pmaxX ) && ( maxY == pmaxY )
+    && ( pfc.isClosed() == fc.isClosed() )
+    && ( ( fc.isClosed() == 0 ) || ( pfc.area() == a ) )
+    && ( fc2.chain == fc.chain ) && ( fc2.x0 == fc.x0 ) && ( fc2.y0 == fc.y0 );
+}
+
+/**
+ * Compares PackedFreemanChain with FreemanChain on the sample contours.
+ */
+bool testPackedFreemanChainSamples()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing PackedFreemanChain on sample contours ..." );
+  const char* files[] = { "samples/freemanChainSample.fc", "samples/contourS.fc",
+			  "samples/france.fc", "samples/klokan.fc", 
+			  "samples/manche.fc" };
+  for ( unsigned int f = 0; f < 5; ++f )
+    {
+      std::vector<Contour> chains = PointListReader<Point>::
+	getFreemanChainsFromFile<Integer>( testPath + files[ f ] );
+      for ( unsigned int i = 0; i < chains.size(); ++i )
+	{
+	  nbok += samePackedChain( chains[ i ] ) ? 1 : 0; 
+	  nb++;
+	  trace.info() << "(" << nbok << "/" << nb << ") "
+		       << files[ f ] << " " << i 
+		       << " " << PackedContour( chains[ i ] )
+		       << " closed=" << chains[ i ].isClosed() << std::endl;
+	}
+    }
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
+/**
+ * Compares PackedFreemanChain with FreemanChain on squares, U-turns
+ * and random open chains of all lengths modulo 32.
+ */
+bool testPackedFreemanChainSmall()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing PackedFreemanChain on small contours ..." );
+  PackedContour square( "00112233", 3, -2 );
+  nbok += ( ( square.isClosed() == 1 ) && ( square.area() == 4 ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "ccw square: isClosed=" << square.isClosed()
+	       << " area=" << square.area() << std::endl;
+  PackedContour cwsquare( "33221100", 0, 0 );
+  nbok += ( ( cwsquare.isClosed() == -1 ) && ( cwsquare.area() == -4 ) ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "cw square: isClosed=" << cwsquare.isClosed()
+	       << " area=" << cwsquare.area() << std::endl;
+  PackedContour spike( "0001201223", 0, 0 );
+  nbok += ( spike.isClosed() == 0 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "U-turn: isClosed=" << spike.isClosed() << std::endl;
+
+  unsigned int nbSame = 0;
+  srand( 0 );
+  for ( unsigned int n = 1; n < 100; ++n )
+    {
+      std::string s;
+      for ( unsigned int i = 0; i < n; ++i )
+	s += (char) ( '0' + ( rand() % 4 ) );
+      nbSame += samePackedChain( Contour( s, rand() % 20 - 10, rand() % 20 - 10 ) ) 
+	? 1 : 0;
+    }
+  nbok += ( nbSame == 99 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << nbSame << "/99 random chains." << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PackedFreemanChain" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPackedFreemanChainSamples() 
+    && testPackedFreemanChainSmall(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
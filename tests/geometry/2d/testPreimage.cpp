@@ -58,6 +58,46 @@ using namespace DGtal;
 using namespace LibBoard;
 
 
+/**
+ * @return 'true' iff the straight line through [A] and [B], with
+ * A[0] < B[0], crosses the closed vertical segments [bInf[k],bSup[k]]
+ * for k in [i,j).
+ */
+template <typename Point>
+bool crossesAll( const Point & A, const Point & B,
+                 const std::vector<Point> & bInf, const std::vector<Point> & bSup,
+                 unsigned int i, unsigned int j )
+{
+  for (unsigned int k = i; k < j; ++k) {
+    long long dx = B[0] - A[0], dy = B[1] - A[1];
+    long long cInf = dx * ( bInf[k][1] - A[1] ) - dy * ( bInf[k][0] - A[0] );
+    long long cSup = dx * ( bSup[k][1] - A[1] ) - dy * ( bSup[k][0] - A[0] );
+    if ( ( cInf > 0 ) || ( cSup < 0 ) ) return false;
+  }
+  return true;
+}
+
+/**
+ * Brute force: the vertical segments [bInf[k],bSup[k]] for k in [i,j),
+ * of increasing abscissas, are crossed by a straight line iff they are
+ * crossed by a straight line through two of their end points, since
+ * their preimage is a convex polygon.
+ */
+template <typename Point>
+bool isFeasible( const std::vector<Point> & bInf, const std::vector<Point> & bSup,
+                 unsigned int i, unsigned int j )
+{
+  if ( j - i < 2 ) return true;
+  for (unsigned int a = i; a < j; ++a)
+    for (unsigned int b = a+1; b < j; ++b)
+      for (int ea = 0; ea < 2; ++ea)
+        for (int eb = 0; eb < 2; ++eb)
+          if ( crossesAll( ea ? bSup[a] : bInf[a], eb ? bSup[b] : bInf[b],
+                           bInf, bSup, i, j ) )
+            return true;
+  return false;
+}
+
 /**** small test, to be completed *******/
 
 int main()
@@ -265,6 +305,89 @@ int main()
   }
   trace.endBlock();
 
+//////////////////////////// test 3 //////////////////////////////////////
+
+  //noisy digital straight lines, 
+  //the preimage is empty between two lines
+  bInf.clear();
+  bSup.clear();
+  for (int x = 0; x < 40; ++x) {
+    int y = (2*x)/5 + ( (x % 7 == 3) ? 1 : 0 );
+    bInf.push_back(Point(x, y));
+    bSup.push_back(Point(x, y+1));
+  }
+  for (int x = 40; x < 80; ++x) {
+    int y = 16 - (3*x-120)/4;
+    bInf.push_back(Point(x, y));
+    bSup.push_back(Point(x, y+1));
+  }
+
+  trace.beginBlock("test greedy preimages");
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  std::vector<Preimage2D::Segment> segments;
+  {
+    Preimage2D thePreimage(bInf.at(0), bSup.at(0));
+    thePreimage.greedyPreimages( bInf.begin(), bInf.end(), bSup.begin(), segments );
+    trace.info() << segments.size() << " segments" << std::endl;
+
+    //same segments and preimages as with addFront
+    bool ok = ( segments.size() > 1 ) && ( segments.front().back == 0 ) 
+      && ( segments.back().front == bInf.size() );
+    unsigned int i = 0;
+    for (unsigned int k = 0; ok && k < segments.size(); ++k) {
+      ok = ( segments[k].back == i );
+      thePreimage.init(bInf.at(i), bSup.at(i));
+      i++;
+      while ( (i < bInf.size()) &&
+          (thePreimage.addFront(bInf.at(i), bSup.at(i))) )
+        i++;
+      ok = ok && ( segments[k].front == i ) 
+        && ( segments[k].pFront == thePreimage.getPFront() )
+        && ( segments[k].pBack == thePreimage.getPBack() )
+        && ( segments[k].qFront == thePreimage.getQFront() )
+        && ( segments[k].qBack == thePreimage.getQBack() );
+      //the preimage is left unchanged by a failure
+      if ( ok && (i < bInf.size()) ) {
+        std::stringstream before, after;
+        before << thePreimage;
+        thePreimage.addFront(bInf.at(i), bSup.at(i));
+        after << thePreimage;
+        ok = ( before.str() == after.str() );
+      }
+    }
+    nbok += ok ? 1 : 0; 
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "greedy preimages == addFront" << std::endl;
+  }
+
+  //brute force: each segment is crossed by a straight line, 
+  //but not with the next vertical segment, and the critical 
+  //straight lines cross the whole segment
+  {
+    bool ok = true;
+    for (unsigned int k = 0; ok && k < segments.size(); ++k) {
+      const Preimage2D::Segment & s = segments[k];
+      ok = isFeasible( bInf, bSup, s.back, s.front )
+        && ( ( s.front == bInf.size() ) 
+             || ! isFeasible( bInf, bSup, s.back, s.front + 1 ) );
+      if ( ok && ( s.pFront[0] != s.qBack[0] ) )
+        ok = ( s.pFront[0] < s.qBack[0] ) 
+          ? crossesAll( s.pFront, s.qBack, bInf, bSup, s.back, s.front )
+          : crossesAll( s.qBack, s.pFront, bInf, bSup, s.back, s.front );
+      if ( ok && ( s.qFront[0] != s.pBack[0] ) )
+        ok = ( s.qFront[0] < s.pBack[0] ) 
+          ? crossesAll( s.qFront, s.pBack, bInf, bSup, s.back, s.front )
+          : crossesAll( s.pBack, s.qFront, bInf, bSup, s.back, s.front );
+    }
+    nbok += ok ? 1 : 0; 
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "greedy preimages == brute force" << std::endl;
+  }
+  trace.endBlock();
 
-  return 0;
+  return ( nbok == nb ) ? 0 : 1;
 }
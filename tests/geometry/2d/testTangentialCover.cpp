@@ -0,0 +1,207 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testTangentialCover.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/27
+ *
+ * Functions for testing class TangentialCover.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+#include "DGtal/geometry/2d/ArithmeticalDSS.h"
+#include "DGtal/geometry/2d/MaximalSegments.h"
+#include "DGtal/geometry/2d/TangentialCover.h"
+#include "DGtal/io/readers/PointListReader.h"
+
+#include "ConfigTest.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int> Contour;
+typedef Contour::PointI2 Point;
+typedef std::vector<Point> Storage;
+typedef Storage::const_iterator ConstIterator;
+typedef ArithmeticalDSS<ConstIterator,int,4> DSS4;
+typedef MaximalSegments<DSS4> Decomposition4;
+typedef TangentialCover<ConstIterator,int,4> Cover4;
+
+/// back, front, a, b, mu
+typedef std::vector<int> Record;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class TangentialCover.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return 'true' if TangentialCover and MaximalSegments give the same
+ * maximal segments on [points], and if TangentialCover gives the same
+ * ones when the curve is cut into chunks.
+ */
+bool sameCover( const Storage & points, bool isClosed )
+{
+  std::vector<Record> ref;
+  DSS4 dss;
+  Decomposition4 decomposition( points.begin(), points.end(), dss, isClosed );
+  for ( Decomposition4::SegmentIterator it = decomposition.begin(),
+	  itE = decomposition.end(); it != itE; ++it )
+    {
+      DSS4 s( *it );
+      Record r( 5 );
+      r[ 0 ] = s.getBack() - points.begin();
+      r[ 1 ] = s.getFront() - points.begin();
+      r[ 2 ] = s.getA(); r[ 3 ] = s.getB(); r[ 4 ] = s.getMu();
+      ref.push_back( r );
+    }
+  std::sort( ref.begin(), ref.end() );
+
+  Cover4 cover;
+  cover.compute( points.begin(), points.end(), isClosed );
+  std::vector<Record> tc;
+  for ( Cover4::SegmentConstIterator it = cover.begin(), itE = cover.end();
+	it != itE; ++it )
+    {
+      Record r( 5 );
+      r[ 0 ] = it->back; r[ 1 ] = it->front;
+      r[ 2 ] = it->a; r[ 3 ] = it->b; r[ 4 ] = it->mu;
+      tc.push_back( r );
+    }
+  bool sorted = true;
+  for ( unsigned int i = 1; i < tc.size(); ++i )
+    sorted = sorted && ( tc[ i - 1 ] < tc[ i ] );
+  // The same cover computed by chunks, even smaller than segments.
+  bool sameChunks = true;
+  const unsigned int nbChunks[] = { 2, 3, 7, 50, 1000 };
+  for ( unsigned int k = 0; k < 5; ++k )
+    {
+      Cover4 pcover;
+      pcover.compute( points.begin(), points.end(), isClosed, nbChunks[ k ] );
+      sameChunks = sameChunks && ( pcover.size() == cover.size() );
+      for ( unsigned int i = 0; sameChunks && ( i < cover.size() ); ++i )
+	sameChunks = ( pcover[ i ].back == cover[ i ].back )
+	  && ( pcover[ i ].front == cover[ i ].front )
+	  && ( pcover[ i ].a == cover[ i ].a )
+	  && ( pcover[ i ].b == cover[ i ].b )
+	  && ( pcover[ i ].mu == cover[ i ].mu );
+    }
+  return sorted && sameChunks && cover.isValid() && ( tc == ref );
+}
+
+/**
+ * Compares TangentialCover with MaximalSegments on sample contours,
+ * processed as closed and open.
+ */
+bool testTangentialCover()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing TangentialCover against MaximalSegments ..." );
+  const char* files[] = { "samples/freemanChainSample.fc", "samples/contourS.fc",
+			  "samples/klokan.fc", "samples/manche.fc" };
+  for ( unsigned int f = 0; f < 4; ++f )
+    {
+      std::vector<Contour> chains = PointListReader<Point>::
+	getFreemanChainsFromFile<int>( testPath + files[ f ] );
+      for ( unsigned int i = 0; i < chains.size(); ++i )
+	{
+	  Storage points;
+	  Contour::getContourPoints( chains[ i ], points );
+	  bool isClosed = chains[ i ].isClosed() != 0;
+	  nbok += sameCover( points, false ) ? 1 : 0; 
+	  nb++;
+	  trace.info() << "(" << nbok << "/" << nb << ") "
+		       << files[ f ] << " " << i << " as open" << std::endl;
+	  if ( isClosed )
+	    {
+	      points.pop_back();
+	      nbok += sameCover( points, true ) ? 1 : 0; 
+	      nb++;
+	      trace.info() << "(" << nbok << "/" << nb << ") "
+			   << files[ f ] << " " << i << " as closed" << std::endl;
+	    }
+	}
+    }
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
+/**
+ * Checks TangentialCover on degenerate curves.
+ */
+bool testTangentialCoverSmall()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing TangentialCover on small curves ..." );
+  Storage points;
+  Cover4 cover;
+  cover.compute( points.begin(), points.end(), false );
+  nbok += ( cover.size() == 0 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << cover << std::endl;
+  points.push_back( Point( 0, 0 ) );
+  cover.compute( points.begin(), points.end(), false );
+  nbok += ( cover.size() == 1 ) && ( cover[ 0 ].back == 0 ) 
+    && ( cover[ 0 ].front == 0 ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << cover << std::endl;
+  Contour square( "00112233", 0, 0 );
+  Contour::getContourPoints( square, points );
+  points.pop_back();
+  nbok += sameCover( points, true ) ? 1 : 0; 
+  nb++;
+  cover.compute( points.begin(), points.end(), true );
+  trace.info() << "(" << nbok << "/" << nb << ") " << cover << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class TangentialCover" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testTangentialCover() 
+    && testTangentialCoverSmall(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,268 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMorphology.cpp
+ * @ingroup Tests
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2011/09/05
+ *
+ * Functions for testing class Morphology.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/topology/MetricAdjacency.h"
+#include "DGtal/topology/DomainAdjacency.h"
+#include "DGtal/topology/DigitalTopology.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/geometry/nd/volumetric/Morphology.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class Morphology.
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename DigitalSet>
+bool sameSets( const DigitalSet & s1, const DigitalSet & s2 )
+{
+  if ( s1.size() != s2.size() ) return false;
+  for ( typename DigitalSet::ConstIterator it = s1.begin();
+	it != s1.end(); ++it )
+    if ( s2.find( *it ) == s2.end() ) return false;
+  return true;
+}
+
+template <typename DigitalSet>
+bool isSubset( const DigitalSet & s1, const DigitalSet & s2 )
+{
+  for ( typename DigitalSet::ConstIterator it = s1.begin();
+	it != s1.end(); ++it )
+    if ( s2.find( *it ) == s2.end() ) return false;
+  return true;
+}
+
+/**
+ * Compares the fast structuring elements (Ball and Box) to the
+ * equivalent Pattern.
+ */
+bool testMorphology()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<2> Z2;
+  typedef Z2::Point Point;
+  typedef Z2::Vector Vector;
+  typedef HyperRectDomain<Z2> Domain;
+  typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  typedef Morphology<DigitalSet> Morpho;
+
+  Domain domain( Point( -30, -30 ), Point( 30, 30 ) );
+  DigitalSet set( domain );
+  // Two disks linked by a thin corridor, plus a few isolated points.
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      Point p = *it;
+      if ( ( ( p - Point( -10, 0 ) ).norm() <= 7.5 )
+	   || ( ( p - Point( 12, 3 ) ).norm() <= 9.2 )
+	   || ( ( p[ 1 ] == 1 ) && ( p[ 0 ] > -10 ) && ( p[ 0 ] < 12 ) )
+	   || ( p == Point( 0, 20 ) ) || ( p == Point( 3, -20 ) ) )
+	set.insertNew( p );
+    }
+
+  trace.beginBlock ( "Ball structuring element versus pattern ..." );
+  double radius = 3.5;
+  Morpho::Ball ball( radius );
+  std::vector<Vector> ballVectors;
+  Domain ballDomain( Point( -3, -3 ), Point( 3, 3 ) );
+  for ( Domain::ConstIterator it = ballDomain.begin();
+	it != ballDomain.end(); ++it )
+    if ( (*it).norm() <= radius ) ballVectors.push_back( *it );
+  Morpho::Pattern ballPattern( ballVectors.begin(), ballVectors.end() );
+  DigitalSet s1( domain ), s2( domain );
+  Morpho::dilation( s1, set, ball );
+  Morpho::dilation( s2, set, ballPattern );
+  nbok += sameSets( s1, s2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") dilation "
+	       << s1.size() << " == " << s2.size() << std::endl;
+  Morpho::erosion( s1, set, ball );
+  Morpho::erosion( s2, set, ballPattern );
+  nbok += sameSets( s1, s2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") erosion "
+	       << s1.size() << " == " << s2.size() << std::endl;
+  Morpho::opening( s1, set, ball );
+  Morpho::opening( s2, set, ballPattern );
+  nbok += ( sameSets( s1, s2 ) && isSubset( s1, set ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") opening "
+	       << s1.size() << " == " << s2.size() << std::endl;
+  Morpho::closing( s1, set, ball );
+  Morpho::closing( s2, set, ballPattern );
+  nbok += ( sameSets( s1, s2 ) && isSubset( set, s1 ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") closing "
+	       << s1.size() << " == " << s2.size() << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Box structuring element versus pattern ..." );
+  Vector halfWidths( 3, 1 );
+  Morpho::Box box( halfWidths );
+  std::vector<Vector> boxVectors;
+  Domain boxDomain( Point( 0, 0 ) - halfWidths, halfWidths );
+  for ( Domain::ConstIterator it = boxDomain.begin();
+	it != boxDomain.end(); ++it )
+    boxVectors.push_back( *it );
+  Morpho::Pattern boxPattern( boxVectors.begin(), boxVectors.end() );
+  Morpho::dilation( s1, set, box );
+  Morpho::dilation( s2, set, boxPattern );
+  nbok += sameSets( s1, s2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") dilation "
+	       << s1.size() << " == " << s2.size() << std::endl;
+  Morpho::erosion( s1, set, box );
+  Morpho::erosion( s2, set, boxPattern );
+  nbok += sameSets( s1, s2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") erosion "
+	       << s1.size() << " == " << s2.size() << std::endl;
+  Morpho::opening( s1, set, box );
+  Morpho::opening( s2, set, boxPattern );
+  nbok += ( sameSets( s1, s2 ) && isSubset( s1, set ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") opening "
+	       << s1.size() << " == " << s2.size() << std::endl;
+  Morpho::closing( s1, set, box );
+  Morpho::closing( s2, set, boxPattern );
+  nbok += ( sameSets( s1, s2 ) && isSubset( set, s1 ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") closing "
+	       << s1.size() << " == " << s2.size() << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Morphology on objects ..." );
+  typedef MetricAdjacency< Z2, 1 > Adj4;
+  typedef MetricAdjacency< Z2, 2 > Adj8;
+  typedef DigitalTopology< Adj4, Adj8 > DT4_8;
+  typedef Object<DT4_8, DigitalSet> ObjectType;
+  Adj4 adj4;
+  Adj8 adj8;
+  DT4_8 dt4_8( adj4, adj8, JORDAN_DT );
+  ObjectType object( dt4_8, set );
+  ObjectType opened = Morpho::opening( object, ball );
+  Morpho::opening( s1, set, ball );
+  nbok += sameSets( opened.pointSet(), s1 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") opened object "
+	       << opened << std::endl;
+  // In-place operation.
+  s1 = set;
+  Morpho::closing( s1, s1, box );
+  Morpho::closing( s2, set, box );
+  nbok += sameSets( s1, s2 ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") in-place closing"
+	       << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Compares the operators by a pattern that does not contain the
+ * origin to their definition, computed by brute force over the
+ * domain.
+ */
+bool testShiftedPattern()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<2> Z2;
+  typedef Z2::Point Point;
+  typedef Z2::Vector Vector;
+  typedef HyperRectDomain<Z2> Domain;
+  typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  typedef Morphology<DigitalSet> Morpho;
+
+  trace.beginBlock ( "Shifted pattern versus brute force ..." );
+  Domain domain( Point( -20, -20 ), Point( 20, 20 ) );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      Point p = *it;
+      if ( ( ( p - Point( -2, 1 ) ).norm() <= 5.5 )
+	   || ( ( p[ 0 ] >= 4 ) && ( p[ 0 ] <= 9 ) && ( p[ 1 ] >= -3 ) && ( p[ 1 ] <= 0 ) ) )
+	set.insertNew( p );
+    }
+  std::vector<Vector> vectors;
+  vectors.push_back( Vector( 4, 2 ) );
+  vectors.push_back( Vector( 5, 2 ) );
+  vectors.push_back( Vector( 4, 3 ) );
+  vectors.push_back( Vector( 6, 1 ) );
+  Morpho::Pattern pattern( vectors.begin(), vectors.end() );
+
+  DigitalSet dilated( domain ), eroded( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      bool inDilation = false;
+      bool inErosion = true;
+      for ( std::vector<Vector>::const_iterator v = vectors.begin();
+	    v != vectors.end(); ++v )
+	{
+	  inDilation = inDilation || ( set.find( *it - *v ) != set.end() );
+	  inErosion = inErosion && ( set.find( *it + *v ) != set.end() );
+	}
+      if ( inDilation ) dilated.insertNew( *it );
+      if ( inErosion ) eroded.insertNew( *it );
+    }
+  DigitalSet s1( domain );
+  Morpho::dilation( s1, set, pattern );
+  nbok += sameSets( s1, dilated ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") dilation "
+	       << s1.size() << " == " << dilated.size() << std::endl;
+  Morpho::erosion( s1, set, pattern );
+  nbok += ( sameSets( s1, eroded ) && ! isSubset( s1, set ) ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") erosion "
+	       << s1.size() << " == " << eroded.size()
+	       << " (not in the set)" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class Morphology" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMorphology() && testShiftedPattern(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testRasterContourExtractor.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/19
+ *
+ * Functions for testing class RasterContourExtractor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/helpers/Surfaces.h"
+#include "DGtal/helpers/RasterContourExtractor.h"
+#include "DGtal/geometry/2d/FreemanChain.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z2i::KSpace KSpace;
+typedef Z2i::Point Point;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class RasterContourExtractor.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A random binary image, made of blobs so that there are holes,
+ * nested contours, diagonal configurations and contours touching the
+ * border of the image.
+ */
+struct RandomShape {
+  typedef Z2i::Point Point;
+  Point low, up;
+  std::vector<bool> values;
+  RandomShape( const Point & l, const Point & u, unsigned int nbBlobs )
+    : low( l ), up( u ),
+      values( ( u[ 0 ] - l[ 0 ] + 1 ) * ( u[ 1 ] - l[ 1 ] + 1 ), false )
+  {
+    for ( unsigned int i = 0; i < nbBlobs; ++i )
+      {
+	Point c( low[ 0 ] + rand() % ( up[ 0 ] - low[ 0 ] + 1 ),
+		 low[ 1 ] + rand() % ( up[ 1 ] - low[ 1 ] + 1 ) );
+	int r = rand() % 6;
+	bool v = ( rand() % 3 ) != 0;
+	for ( int y = c[ 1 ] - r; y <= c[ 1 ] + r; ++y )
+	  for ( int x = c[ 0 ] - r; x <= c[ 0 ] + r; ++x )
+	    if ( ( x - c[ 0 ] ) * ( x - c[ 0 ] ) + ( y - c[ 1 ] ) * ( y - c[ 1 ] )
+		 <= r * r + 1 )
+	      set( Point( x, y ), v );
+      }
+    // Some isolated pixels.
+    for ( unsigned int i = 0; i < nbBlobs; ++i )
+      set( Point( low[ 0 ] + rand() % ( up[ 0 ] - low[ 0 ] + 1 ),
+		  low[ 1 ] + rand() % ( up[ 1 ] - low[ 1 ] + 1 ) ),
+	   ( rand() % 2 ) != 0 );
+  }
+  void set( const Point & p, bool v )
+  {
+    if ( ( low[ 0 ] <= p[ 0 ] ) && ( p[ 0 ] <= up[ 0 ] )
+	 && ( low[ 1 ] <= p[ 1 ] ) && ( p[ 1 ] <= up[ 1 ] ) )
+      values[ ( p[ 1 ] - low[ 1 ] ) * ( up[ 0 ] - low[ 0 ] + 1 )
+	      + p[ 0 ] - low[ 0 ] ] = v;
+  }
+  bool operator()( const Point & p ) const
+  {
+    return values[ ( p[ 1 ] - low[ 1 ] ) * ( up[ 0 ] - low[ 0 ] + 1 )
+		   + p[ 0 ] - low[ 0 ] ];
+  }
+};
+
+/**
+ * Compares the contours with the ones of Surfaces on random images,
+ * for several heights of bands.
+ */
+bool testRasterContourExtractor( bool interior )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing contours of random shapes ..." );
+  Point low( -7, -5 );
+  Point up( 40, 33 );
+  KSpace K;
+  K.init( low, up, true );
+  SurfelAdjacency<2> SAdj( interior );
+  for ( unsigned int n = 0; n < 20; ++n )
+    {
+      RandomShape shape( low, up, 5 + 4 * n );
+      std::vector< std::vector<Point> > expected;
+      Surfaces<KSpace>::extractAllPointContours4C( expected, K, shape, SAdj );
+      const int heights[ 4 ] = { 1, 2, 7, 64 };
+      bool same = true;
+      for ( unsigned int h = 0; h < 4; ++h )
+	{
+	  std::vector< std::vector<Point> > contours;
+	  RasterContourExtractor<KSpace>::extractAllPointContours4C
+	    ( contours, K, shape, SAdj, heights[ h ] );
+	  same = same && ( contours == expected );
+	}
+      std::vector< FreemanChain<Z2i::Integer> > chains;
+      RasterContourExtractor<KSpace>::extractAllFreemanChains
+	( chains, K, shape, SAdj, 5 );
+      same = same && ( chains.size() == expected.size() );
+      for ( unsigned int i = 0; same && ( i < chains.size() ); ++i )
+	{
+	  FreemanChain<Z2i::Integer> fc( expected[ i ] );
+	  same = ( chains[ i ].chain == fc.chain )
+	    && ( chains[ i ].x0 == fc.x0 ) && ( chains[ i ].y0 == fc.y0 )
+	    && ( chains[ i ].xn == fc.xn ) && ( chains[ i ].yn == fc.yn );
+	}
+      nbok += same ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+		   << expected.size() << " contours." << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class RasterContourExtractor" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  bool res = testRasterContourExtractor( true )
+    && testRasterContourExtractor( false );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaceMeshExtractor.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/15
+ *
+ * Functions for testing class SurfaceMeshExtractor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageSelector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/helpers/Surfaces.h"
+#include "DGtal/helpers/SurfaceMeshExtractor.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<3> KSpace;
+typedef KSpace::Point Point;
+typedef KSpace::SCell SCell;
+typedef SpaceND<3> Space;
+typedef HyperRectDomain<Space> Domain;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfaceMeshExtractor.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Two overlapping balls.
+ */
+struct TwoBalls {
+  typedef KSpace::Point Point;
+  bool operator()( const Point & p ) const
+  {
+    Point q( p[ 0 ] - 3, p[ 1 ], p[ 2 ] - 1 );
+    return ( p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] + p[ 2 ] * p[ 2 ] <= 25 )
+      || ( q[ 0 ] * q[ 0 ] + q[ 1 ] * q[ 1 ] + q[ 2 ] * q[ 2 ] <= 16 );
+  }
+};
+
+/**
+ * A mesh stored in memory, a model of the mesh output of
+ * SurfaceMeshExtractor.
+ */
+struct MemoryMesh {
+  typedef unsigned int Index;
+  std::vector<double> vertices;
+  std::vector<Index> triangles;
+  Index addVertex( double x, double y, double z )
+  {
+    vertices.push_back( x );
+    vertices.push_back( y );
+    vertices.push_back( z );
+    return vertices.size() / 3 - 1;
+  }
+  void addTriangle( Index i, Index j, Index k )
+  {
+    triangles.push_back( i );
+    triangles.push_back( j );
+    triangles.push_back( k );
+  }
+  unsigned int nbVertices() const { return vertices.size() / 3; }
+  unsigned int nbTriangles() const { return triangles.size() / 3; }
+
+  /// 'true' iff each edge is used once in each direction.
+  bool isClosedManifold() const
+  {
+    std::map< std::pair<Index,Index>, int > edges;
+    for ( unsigned int t = 0; t < triangles.size(); t += 3 )
+      for ( unsigned int e = 0; e < 3; ++e )
+	edges[ std::make_pair( triangles[ t + e ],
+			       triangles[ t + ( e + 1 ) % 3 ] ) ] += 1;
+    for ( std::map< std::pair<Index,Index>, int >::const_iterator
+	    it = edges.begin(); it != edges.end(); ++it )
+      {
+	std::map< std::pair<Index,Index>, int >::const_iterator opp
+	  = edges.find( std::make_pair( it->first.second, it->first.first ) );
+	if ( ( it->second != 1 ) || ( opp == edges.end() ) ) return false;
+      }
+    return true;
+  }
+
+  /// The volume enclosed by the mesh (divergence theorem).
+  double volume() const
+  {
+    double vol = 0.0;
+    for ( unsigned int t = 0; t < triangles.size(); t += 3 )
+      {
+	const double* a = & vertices[ 3 * triangles[ t ] ];
+	const double* b = & vertices[ 3 * triangles[ t + 1 ] ];
+	const double* c = & vertices[ 3 * triangles[ t + 2 ] ];
+	vol += a[ 0 ] * ( b[ 1 ] * c[ 2 ] - b[ 2 ] * c[ 1 ] )
+	  - a[ 1 ] * ( b[ 0 ] * c[ 2 ] - b[ 2 ] * c[ 0 ] )
+	  + a[ 2 ] * ( b[ 0 ] * c[ 1 ] - b[ 1 ] * c[ 0 ] );
+      }
+    return vol / 6.0;
+  }
+};
+
+/**
+ * Checks that the mesh of a shape is closed, consistently oriented,
+ * has the volume of the shape and does not depend on the batches or
+ * on the input.
+ */
+bool testSurfaceMeshExtractor()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing mesh extraction ..." );
+  KSpace K;
+  Point low = Point::diagonal( -8 );
+  Point high = Point::diagonal( 9 );
+  K.init( low, high, true );
+  TwoBalls shape;
+  unsigned int nbSpels = 0;
+  Domain domain( low, high );
+  typedef ImageSelector<Domain, int>::Type Image;
+  Image image( low, high );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    {
+      nbSpels += shape( *it ) ? 1 : 0;
+      image.setValue( *it, shape( *it ) ? 200 : 10 );
+    }
+
+  MemoryMesh mesh;
+  SurfaceMeshExtractor<KSpace>::extractFromPredicate( mesh, K, shape );
+  nbok += ( mesh.isClosedManifold()
+	    && ( mesh.nbVertices() == mesh.nbTriangles() / 2 + 2 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << mesh.nbVertices() << " vertices, " << mesh.nbTriangles()
+	       << " triangles, closed and of genus 0." << std::endl;
+  nbok += ( mesh.volume() == (double) nbSpels ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "volume=" << mesh.volume() << " nbSpels=" << nbSpels
+	       << std::endl;
+
+  MemoryMesh mesh_batches;
+  SurfaceMeshExtractor<KSpace>::extractFromPredicate( mesh_batches, K, shape, 2 );
+  MemoryMesh mesh_image;
+  SurfaceMeshExtractor<KSpace>::extractFromImage( mesh_image, K, image, 100, 3 );
+  nbok += ( mesh_batches.isClosedManifold()
+	    && ( mesh_batches.nbVertices() == mesh.nbVertices() )
+	    && ( mesh_batches.nbTriangles() == mesh.nbTriangles() )
+	    && ( mesh_batches.volume() == mesh.volume() )
+	    && ( mesh_image.nbVertices() == mesh.nbVertices() )
+	    && ( mesh_image.nbTriangles() == mesh.nbTriangles() )
+	    && ( mesh_image.volume() == mesh.volume() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same mesh by batches of layers and from an image." << std::endl;
+
+  Surfaces<KSpace>::SurfelSet bdry;
+  SurfelAdjacency<3> SAdj( true );
+  SCell bel = Surfaces<KSpace>::findABel( K, shape, 10000 );
+  Surfaces<KSpace>::trackBoundary( bdry, K, SAdj, shape, bel );
+  MemoryMesh mesh_surfels;
+  SurfaceMeshExtractor<KSpace>::extract( mesh_surfels, K,
+					 bdry.begin(), bdry.end() );
+  nbok += ( mesh_surfels.isClosedManifold()
+	    && ( mesh_surfels.nbVertices() == mesh.nbVertices() )
+	    && ( mesh_surfels.nbTriangles() == mesh.nbTriangles() )
+	    && ( mesh_surfels.volume() == mesh.volume() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same mesh from tracked surfels." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SurfaceMeshExtractor" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSurfaceMeshExtractor();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
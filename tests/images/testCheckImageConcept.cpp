@@ -33,6 +33,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
 #ifdef WITH_ITK
 #include "DGtal/images/ImageContainerByITKImage.h"
 #endif
@@ -61,6 +62,7 @@ bool testCheckImageConcept()
   
   typedef ImageContainerBySTLVector<Domain, int> ImageVector;
   typedef ImageContainerBySTLVector<Domain, int> ImageMap;
+  typedef ImageContainerByMappedFile<Domain, int> ImageMappedFile;
  
 #ifdef WITH_ITK
  typedef experimental::ImageContainerByITKImage<Domain, int> ImageITK;
@@ -71,6 +73,7 @@ bool testCheckImageConcept()
 
   BOOST_CONCEPT_ASSERT ((CImageContainer< ImageVector >));
   BOOST_CONCEPT_ASSERT ((CImageContainer< ImageMap >));
+  BOOST_CONCEPT_ASSERT ((CImageContainer< ImageMappedFile >));
 #ifdef WITH_ITK
   BOOST_CONCEPT_ASSERT ((CImageContainer< ImageITK >));
 #endif
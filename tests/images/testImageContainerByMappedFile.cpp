@@ -0,0 +1,252 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByMappedFile.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/10/09
+ *
+ * Functions for testing class ImageContainerByMappedFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdio>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#include "DGtal/io/colormaps/GrayScaleColorMap.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+#include "DGtal/io/readers/VolReader.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByMappedFile.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Maps a .vol and a .longvol file written from the same image and
+ * compares them with the image read by VolReader.
+ */
+bool testVolFiles()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> MappedVol;
+  typedef ImageContainerByMappedFile<Z3i::Domain, DGtal::uint64_t> MappedLongvol;
+
+  trace.beginBlock ( "Writing vol and longvol files ..." );
+  Z3i::Point a( 0, 0, 0 );
+  Z3i::Point b( 12, 7, 5 );
+  Image image( a, b );
+  Z3i::Domain domain( a, b );
+  for ( Z3i::Domain::ConstIterator it = domain.range().begin(),
+	  itend = domain.range().end(); it != itend; ++it )
+    image.setValue( *it, (unsigned char) ( ( (*it)[0] * 7 + (*it)[1] * 31 + (*it)[2] * 59 ) % 256 ) );
+  VolWriter<Image, GrayscaleColorMap<unsigned char> >
+    ::exportVol( "testMappedFile.vol", image, 0, 255 );
+  LongvolWriter<Image, GrayscaleColorMap<unsigned char> >
+    ::exportLongvol( "testMappedFile.longvol", image, 0, 255 );
+  Image ref = VolReader<Image>::importVol( "testMappedFile.vol" );
+  trace.endBlock();
+
+  trace.beginBlock ( "Mapping the vol file ..." );
+  MappedVol vol;
+  vol.openVol( "testMappedFile.vol" );
+  trace.info() << vol << std::endl;
+  nbok += ( vol.isValid() && ( vol.lowerBound() == a ) && ( vol.upperBound() == b ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "vol bounds are " << a << " " << b << std::endl;
+  bool allFine = true;
+  for ( Z3i::Domain::ConstIterator it = domain.range().begin(),
+	  itend = domain.range().end(); it != itend; ++it )
+    allFine = allFine && ( vol( *it ) == ref( *it ) );
+  Image::ConstIterator itRef = ref.begin();
+  for ( MappedVol::ConstIterator it = vol.begin(), itend = vol.end();
+	it != itend; ++it, ++itRef )
+    allFine = allFine && ( vol( it ) == *itRef );
+  nbok += allFine ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "vol(p) == VolReader(p)" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Mapping the longvol file ..." );
+  MappedLongvol longvol;
+  longvol.openLongvol( "testMappedFile.longvol" );
+  trace.info() << longvol << std::endl;
+  allFine = longvol.size() == ref.size();
+  for ( Z3i::Domain::ConstIterator it = domain.range().begin(),
+	  itend = domain.range().end(); it != itend; ++it )
+    allFine = allFine && ( longvol( *it ) == (DGtal::uint64_t) ref( *it ) );
+  nbok += allFine ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "longvol(p) == VolReader(p)" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Span iterators and extraction ..." );
+  allFine = true;
+  for ( Dimension d = 0; d < 3; ++d )
+    {
+      Z3i::Point p( 3, 2, 1 );
+      p[ d ] = 0;
+      Image::SpanIterator itSpanRef = ref.spanBegin( p, d );
+      for ( MappedLongvol::SpanIterator it = longvol.spanBegin( p, d ),
+	      itend = longvol.spanEnd( p, d ); it != itend; ++it, ++itSpanRef )
+	allFine = allFine && ( longvol( it ) == (DGtal::uint64_t) ref( itSpanRef ) );
+    }
+  nbok += allFine ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "span iterators follow the image" << std::endl;
+  Z3i::Point c( 2, 1, 4 );
+  Z3i::Point d( 9, 6, 2 );
+  ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> box = longvol.extract( c, d );
+  Z3i::Domain boxDomain( c.inf( d ), c.sup( d ) );
+  allFine = ( box.lowerBound() == c.inf( d ) ) && ( box.upperBound() == c.sup( d ) );
+  for ( Z3i::Domain::ConstIterator it = boxDomain.range().begin(),
+	  itend = boxDomain.range().end(); it != itend; ++it )
+    allFine = allFine && ( box( *it ) == (DGtal::uint64_t) ref( *it ) );
+  nbok += allFine ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "extract( " << c << ", " << d << " ) == sub-image" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Maps a raw file of big endian 16-bit words after a header, and
+ * checks that setValue does not modify the file.
+ */
+bool testRawFile()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef ImageContainerByMappedFile<Z2i::Domain, DGtal::uint16_t> Mapped;
+
+  trace.beginBlock ( "Mapping a raw file ..." );
+  Z2i::Point a( -3, 2 );
+  Z2i::Point b( 5, 9 );
+  const unsigned int offset = 5;
+  FILE * out = fopen( "testMappedFile.raw", "wb" );
+  fputs( "HEAD\n", out );
+  for ( unsigned int i = 0; i < 9 * 8; ++i )
+    {
+      DGtal::uint16_t v = i * 911;
+      fputc( v >> 8, out );
+      fputc( v & 0xFF, out );
+    }
+  fclose( out );
+
+  Mapped raw;
+  raw.openRaw( "testMappedFile.raw", b, a, offset, true );
+  trace.info() << raw << std::endl;
+  bool allFine = ( raw.lowerBound() == a ) && ( raw.upperBound() == b );
+  for ( int y = a[ 1 ]; y <= b[ 1 ]; ++y )
+    for ( int x = a[ 0 ]; x <= b[ 0 ]; ++x )
+      {
+	DGtal::uint16_t v = ( ( x - a[ 0 ] ) + 9 * ( y - a[ 1 ] ) ) * 911;
+	allFine = allFine && ( raw( Z2i::Point( x, y ) ) == v );
+      }
+  nbok += allFine ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "big endian values are read at their place" << std::endl;
+
+  raw.setValue( a, 1234 );
+  Mapped::Iterator it = raw.end();
+  --it;
+  raw.setValue( it, 4321 );
+  nbok += ( ( raw( a ) == 1234 ) && ( raw( b ) == 4321 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "setValue changes the values in memory" << std::endl;
+  Mapped raw2;
+  raw2.openRaw( "testMappedFile.raw", a, b, offset, true );
+  nbok += ( ( raw2( a ) == 0 ) && ( raw2( b ) == (DGtal::uint16_t) ( 71 * 911 ) ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "setValue does not change the file" << std::endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Errors ..." );
+  bool caught = false;
+  try
+    {
+      raw.openRaw( "testMappedFile.raw", a, b + Z2i::Point( 0, 1 ), offset, true );
+    }
+  catch ( IOException & e )
+    {
+      caught = true;
+    }
+  nbok += ( caught && ! raw.isOpen() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "too short file throws IOException" << std::endl;
+  caught = false;
+  try
+    {
+      raw.openRaw( "testMappedFile-missing.raw", a, b );
+    }
+  catch ( IOException & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "missing file throws IOException" << std::endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByMappedFile" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testVolFiles() && testRawFile(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
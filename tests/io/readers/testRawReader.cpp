@@ -34,6 +34,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/io/colormaps/HueShadeColorMap.h"
 #include "DGtal/io/colormaps/GrayScaleColorMap.h"
 #include "DGtal/io/colormaps/GradientColorMap.h"
@@ -80,6 +81,19 @@ bool testRawReader2D()
   ///FIXME: check io errors
   trace.info() << image <<endl;
 
+  //same values as read byte by byte
+  FILE * fin = fopen( filename.c_str(), "rb" );
+  bool sameValues = ( fin != NULL );
+  for ( TDomain::ConstIterator it = image.domain().range().begin(),
+          itend = image.domain().range().end(); 
+        sameValues && ( it != itend ); ++it )
+    sameValues = ( image( *it ) == (unsigned char) getc( fin ) );
+  if ( fin != NULL ) fclose( fin );
+  nbok += sameValues ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same values as getc" << std::endl;
+
   //export
   typedef GrayscaleColorMap<unsigned char> Gray;  
   PNMWriter<Image,Gray>::exportPGM("export-raw-reader.pgm",image,0,255);
@@ -95,6 +109,94 @@ bool testRawReader2D()
   return nbok == nb;
 }
 
+/**
+ * Writes a 3D raw file of 16-bit words, big endian, and of floats,
+ * in the byte order of the computer, and reads them again into
+ * several images.
+ */
+bool testRawReaderWords()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing Raw reader with 16/32-bit words ..." );
+  
+  typedef SpaceND<3> Space3;
+  typedef HyperRectDomain<Space3> TDomain;
+  typedef TDomain::Vector Vector;
+  typedef TDomain::Point Point;
+  typedef ImageContainerBySTLVector<TDomain, unsigned short> Image16;
+  typedef ImageContainerBySTLVector<TDomain, int> ImageInt;
+  typedef ImageContainerBySTLVector<TDomain, float> ImageFloat;
+  
+  Vector ext(7,5,3);
+  const unsigned int size = 7*5*3;
+  
+  FILE * out16 = fopen( "raw3D-16bits.raw", "wb" );
+  FILE * outFloat = fopen( "raw3D-float.raw", "wb" );
+  for ( unsigned int i = 0; i < size; ++i )
+    {
+      unsigned short v = 1000*i + 7;
+      fputc( v >> 8, out16 );
+      fputc( v & 255, out16 );
+      float f = 0.5f * i - 3.0f;
+      fwrite( &f, sizeof( float ), 1, outFloat );
+    }
+  fclose( out16 );
+  fclose( outFloat );
+
+  for ( unsigned int nbChunks = 1; nbChunks <= 4; nbChunks += 3 )
+    {
+      Image16 image16 = 
+	RawReader<Image16>::importRaw<unsigned short>( "raw3D-16bits.raw", ext, 
+						       true, nbChunks );
+      ImageInt imageInt = 
+	RawReader<ImageInt>::importRaw<unsigned short>( "raw3D-16bits.raw", ext, 
+							true, nbChunks );
+      ImageFloat imageFloat = 
+	RawReader<ImageFloat>::importRaw<float>( "raw3D-float.raw", ext, 
+						 false, nbChunks );
+
+      bool ok16 = true, okFloat = true;
+      unsigned int i = 0;
+      for ( TDomain::ConstIterator it = image16.domain().range().begin(),
+	      itend = image16.domain().range().end(); it != itend; ++it, ++i )
+	{
+	  Point p = *it;
+	  unsigned short v = 1000*i + 7;
+	  ok16 = ok16 && ( image16( p ) == v ) && ( imageInt( p ) == (int) v );
+	  okFloat = okFloat && ( imageFloat( p ) == 0.5f * i - 3.0f );
+	}
+      nbok += ( ok16 && ( i == size ) ) ? 1 : 0; 
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+		   << "16-bit big endian, " << nbChunks << " chunk(s)" << std::endl;
+      nbok += okFloat ? 1 : 0; 
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+		   << "float, " << nbChunks << " chunk(s)" << std::endl;
+    }
+
+  //file too short
+  bool caught = false;
+  try 
+    {
+      RawReader<Image16>::importRaw<unsigned short>( "raw3D-16bits.raw", 
+						     Vector(7,5,4), true, 2 );
+    }
+  catch ( IOException & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "IOException on a short file" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -106,7 +208,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testRawReader2D(); // && ... other tests
+  bool res = testRawReader2D()
+    && testRawReaderWords(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
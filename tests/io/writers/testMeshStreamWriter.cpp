@@ -0,0 +1,148 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshStreamWriter.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/15
+ *
+ * Functions for testing class MeshStreamWriter.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "DGtal/base/Common.h"
+#include "DGtal/io/writers/MeshStreamWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MeshStreamWriter.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Writes a tetrahedron, its faces being given before its last vertex.
+ */
+void writeTetrahedron( MeshStreamWriter & writer )
+{
+  writer.addVertex( 0.0, 0.0, 0.0 );
+  writer.addVertex( 1.0, 0.0, 0.0 );
+  writer.addVertex( 0.0, 1.0, 0.0 );
+  writer.addTriangle( 0, 2, 1 );
+  writer.addTriangle( 0, 1, 3 );
+  writer.addTriangle( 1, 2, 3 );
+  writer.addTriangle( 2, 0, 3 );
+  writer.addVertex( 0.0, 0.0, 1.5 );
+}
+
+/**
+ * @return the content of the file [filename].
+ */
+std::string readFile( const std::string & filename )
+{
+  std::ifstream in( filename.c_str(), ios::in | ios::binary );
+  std::ostringstream content;
+  content << in.rdbuf();
+  return content.str();
+}
+
+/**
+ * @return the unsigned integer stored at [s] in little-endian order
+ * if [little], big-endian otherwise.
+ */
+unsigned int getUInt( const std::string & s, std::size_t pos, bool little )
+{
+  unsigned int v = 0;
+  for ( int i = 0; i < 4; ++i )
+    v |= ( (unsigned int) (unsigned char) s[ pos + ( little ? i : 3 - i ) ] ) << ( 8 * i );
+  return v;
+}
+
+bool testMeshStreamWriter()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing binary PLY and OFF output ..." );
+  MeshStreamWriter writer;
+  writer.open( "tetrahedron.ply" );
+  writeTetrahedron( writer );
+  trace.info() << writer << std::endl;
+  writer.close();
+  std::string ply = readFile( "tetrahedron.ply" );
+  std::size_t body = ply.find( "end_header\n" ) + 11;
+  nbok += ( ply.compare( 0, 4, "ply\n" ) == 0 )
+    && ( ply.find( "element vertex          4\n" ) != std::string::npos )
+    && ( ply.find( "element face          4\n" ) != std::string::npos )
+    && ( ply.size() == body + 4 * 12 + 4 * 13 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "PLY header and size." << std::endl;
+  // Last vertex z=1.5f, then last face (3, 2, 0, 3).
+  nbok += ( getUInt( ply, body + 3 * 12 + 8, true ) == 0x3fc00000u )
+    && ( ply[ body + 4 * 12 + 3 * 13 ] == 3 )
+    && ( getUInt( ply, body + 4 * 12 + 3 * 13 + 1, true ) == 2 )
+    && ( getUInt( ply, body + 4 * 12 + 3 * 13 + 9, true ) == 3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "PLY little-endian content." << std::endl;
+
+  writer.open( "tetrahedron.off" );
+  writeTetrahedron( writer );
+  writer.close();
+  std::string off = readFile( "tetrahedron.off" );
+  nbok += ( off.compare( 0, 11, "OFF BINARY\n" ) == 0 )
+    && ( getUInt( off, 11, false ) == 4 )
+    && ( getUInt( off, 15, false ) == 4 )
+    && ( getUInt( off, 19, false ) == 0 )
+    && ( off.size() == 23 + 4 * 12 + 4 * 20 )
+    && ( getUInt( off, 23 + 3 * 12 + 8, false ) == 0x3fc00000u )
+    && ( getUInt( off, 23 + 4 * 12 + 3 * 20 + 12, false ) == 3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "OFF big-endian header and content." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MeshStreamWriter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testMeshStreamWriter();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
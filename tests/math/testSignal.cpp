@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cmath>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/math/Signal.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -79,6 +81,74 @@ bool testSignal()
 }
 
 
+/**
+ * @return the largest difference between the direct and FFT
+ * convolutions of a random signal and the gaussian G2n( [n] ).
+ */
+double maxDifference( unsigned int size, int zero, bool periodic, 
+		      double def, unsigned int n )
+{
+  Signal<double> F( size, zero, periodic, def );
+  for ( unsigned int i = 0; i < size; ++i )
+    F[ (int) i - zero ] = (double) ( rand() % 1000 ) / 10.0;
+  Signal<double> G = Signal<double>::G2n( n ) * Signal<double>::Delta();
+  Signal<double> FG1 = F.directProduct( G );
+  Signal<double> FG2 = F.fftProduct( G );
+  if ( FG1.size() != FG2.size() ) return 1.0e10;
+  double diff = 0.0;
+  for ( int i = -2 * (int) FG1.size(); i < 2 * (int) FG1.size(); ++i )
+    diff = std::max( diff, std::abs( FG1[ i ] - FG2[ i ] ) );
+  return diff;
+}
+
+/**
+ * Checks that FFT convolution gives the same signals as the direct
+ * convolution.
+ */
+bool testFFTProduct()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing FFT convolution ..." );
+  srand( 0 );
+  const double eps = 1e-8;
+  // size, zero, periodic, default, order of the gaussian.
+  double diff = maxDifference( 1000, 0, false, 0.0, 40 );
+  nbok += ( diff < eps ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "non periodic, diff=" << diff << std::endl;
+  diff = maxDifference( 777, 13, false, 2.5, 25 );
+  nbok += ( diff < eps ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "non periodic with default value, diff=" << diff << std::endl;
+  diff = maxDifference( 1000, 0, true, 0.0, 40 );
+  nbok += ( diff < eps ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "periodic, diff=" << diff << std::endl;
+  diff = maxDifference( 333, 7, true, 0.0, 30 );
+  nbok += ( diff < eps ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "periodic with zero, diff=" << diff << std::endl;
+  diff = maxDifference( 17, 3, true, 0.0, 20 );
+  nbok += ( diff < eps ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "periodic shorter than the kernel, diff=" << diff << std::endl;
+  diff = maxDifference( 1, 0, false, 1.0, 3 );
+  nbok += ( diff < eps ) ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "one value, diff=" << diff << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -90,7 +160,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testSignal();
+  bool res = testSignal() && testFFTProduct();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,155 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCachedSurfelNeighborhood-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/21
+ *
+ * Benchmarks boundary tracking with SurfelNeighborhood versus
+ * CachedSurfelNeighborhood (i.e. Surfaces::trackBoundary), on the
+ * boundary of a ball of radius 100 (the radius may be given as
+ * first argument), given by an arithmetic predicate or by a digital
+ * set.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <queue>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/SCellHashSet.h"
+#include "DGtal/kernel/sets/SetPredicate.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::Z3i;
+
+typedef KSpace::SCell SCell;
+typedef Surfaces<KSpace>::SurfelSet SurfelSet;
+
+/**
+ * The digital ball of radius [r] centered on the origin.
+ */
+struct BallPredicate {
+  typedef KSpace::Point Point;
+  Point::Coordinate r2;
+  BallPredicate( Point::Coordinate r ) : r2( r * r ) {}
+  bool operator()( const Point & p ) const
+  { return p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] + p[ 2 ] * p[ 2 ] <= r2; }
+};
+
+/**
+ * Tracks the boundary of [pp] from [bel] with a SurfelNeighborhood,
+ * as Surfaces::trackBoundary did before CachedSurfelNeighborhood.
+ */
+template <typename PointPredicate>
+void trackBoundaryWithSurfelNeighborhood( SurfelSet & surface,
+					  const KSpace & K,
+					  const SurfelAdjacency<3> & surfel_adj,
+					  const PointPredicate & pp,
+					  const SCell & start_surfel )
+{
+  SCell b;
+  SCell bn;
+  surface.init( K );
+  SurfelNeighborhood<KSpace> SN;
+  SN.init( &K, &surfel_adj, start_surfel );
+  std::queue<SCell> qbels;
+  qbels.push( start_surfel );
+  surface.insert( start_surfel );
+  while ( ! qbels.empty() )
+    {
+      b = qbels.front();
+      qbels.pop();
+      SN.setSurfel( b );
+      for ( KSpace::DirIterator q = K.sDirs( b ); q != 0; ++q )
+	for ( unsigned int j = 0; j < 2; ++j )
+	  if ( SN.getAdjacentOnPointPredicate( bn, pp, *q, j == 0 )
+	       && ( surface.find( bn ) == surface.end() ) )
+	    {
+	      surface.insert( bn );
+	      qbels.push( bn );
+	    }
+    }
+}
+
+/**
+ * Times both trackings of the boundary of [pp].
+ */
+template <typename PointPredicate>
+bool bench( const std::string & name, const KSpace & K,
+	    const PointPredicate & pp, const SCell & bel )
+{
+  SurfelAdjacency<3> SAdj( true );
+  SurfelSet s1, s2;
+  trace.beginBlock( name + " - SurfelNeighborhood" );
+  trackBoundaryWithSurfelNeighborhood( s1, K, SAdj, pp, bel );
+  trace.info() << s1.size() << " surfels." << std::endl;
+  trace.endBlock();
+  trace.beginBlock( name + " - CachedSurfelNeighborhood" );
+  Surfaces<KSpace>::trackBoundary( s2, K, SAdj, pp, bel );
+  trace.info() << s2.size() << " surfels." << std::endl;
+  trace.endBlock();
+  return s1.size() == s2.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking CachedSurfelNeighborhood for boundary tracking" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  int radius = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100;
+  KSpace K;
+  Point low = Point::diagonal( -radius - 2 );
+  Point up = Point::diagonal( radius + 2 );
+  K.init( low, up, true );
+  BallPredicate ball( radius );
+  // The surfel between the rightmost spel of the ball and its outside.
+  SCell bel = K.sIncident( K.sSpel( Point( radius, 0, 0 ), K.POS ), 0, true );
+  bool res = bench( "Ball predicate", K, ball, bel );
+
+  trace.beginBlock( "Filling the digital set" );
+  Domain domain( low, up );
+  DigitalSet set( domain );
+  for ( Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it )
+    if ( ball( *it ) ) set.insertNew( *it );
+  SetPredicate<DigitalSet> setPred( set );
+  trace.endBlock();
+  res = res && bench( "Set predicate", K, setPred, bel );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,183 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCachedSurfelNeighborhood.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/21
+ *
+ * Functions for testing class CachedSurfelNeighborhood.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SurfelNeighborhood.h"
+#include "DGtal/topology/CachedSurfelNeighborhood.h"
+#include "DGtal/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CachedSurfelNeighborhood.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A ball of radius 4 and a half-space touching the border of the
+ * space, so that some bels have no follower.
+ */
+template <typename TPoint>
+struct BallAndHalfSpace {
+  typedef TPoint Point;
+  typedef typename Point::Coordinate Coordinate;
+  bool operator()( const Point & p ) const
+  {
+    Coordinate n = 0;
+    Coordinate s = 0;
+    for ( Dimension k = 0; k < Point::dimension; ++k )
+      {
+	n += p[ k ] * p[ k ];
+	s += p[ k ];
+      }
+    return ( n <= 16 ) || ( s >= 10 );
+  }
+};
+
+/**
+ * Compares the adjacent bels given by CachedSurfelNeighborhood with
+ * the ones of SurfelNeighborhood, for all bels and directions.
+ */
+template <typename KSpace>
+bool testCachedSurfelNeighborhood( bool interior, std::size_t cacheSize )
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::DirIterator DirIterator;
+  typedef BallAndHalfSpace<Point> Shape;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing CachedSurfelNeighborhood ..." );
+  trace.info() << "dim=" << KSpace::dimension << " interior=" << interior
+	       << " cache=" << cacheSize << std::endl;
+  KSpace K;
+  K.init( Point::diagonal( -6 ), Point::diagonal( 6 ), true );
+  Shape shape;
+  SurfelAdjacency<KSpace::dimension> SAdj( interior );
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, shape,
+				   K.uSpel( K.lowerBound() ),
+				   K.uSpel( K.upperBound() ) );
+  SurfelNeighborhood<KSpace> SN;
+  SN.init( &K, &SAdj, *bdry.begin() );
+  CachedSurfelNeighborhood<KSpace, Shape> CSN( K, SAdj, shape, cacheSize );
+  nbok += CSN.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << CSN << std::endl;
+
+  unsigned int nbSame = 0;
+  unsigned int nbMoves = 0;
+  unsigned int nbBorder = 0;
+  for ( typename std::set<SCell>::const_iterator it = bdry.begin();
+	it != bdry.end(); ++it )
+    {
+      SN.setSurfel( *it );
+      CSN.setSurfel( *it );
+      Dimension i = 0;
+      for ( DirIterator q = K.sDirs( *it ); q != 0; ++q, ++i )
+	{
+	  Dimension track_dir = *q;
+	  bool sameDir = ( i < CSN.nbTrackDirs() )
+	    && ( CSN.trackDir( i ) == track_dir );
+	  for ( unsigned int j = 0; j < 2; ++j )
+	    {
+	      bool pos = ( j == 0 );
+	      SCell b1, b2;
+	      unsigned int f1 = SN.getAdjacentOnPointPredicate
+		( b1, shape, track_dir, pos );
+	      unsigned int f2 = CSN.getAdjacentOnPointPredicate
+		( b2, track_dir, pos );
+	      ++nbMoves;
+	      nbBorder += ( f1 == 0 ) ? 1 : 0;
+	      nbSame += ( sameDir && ( f1 == f2 )
+			  && ( ( f1 == 0 ) || ( b1 == b2 ) ) ) ? 1 : 0;
+	    }
+	}
+    }
+  nbok += ( nbSame == nbMoves ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << nbSame << "/" << nbMoves << " same adjacent bels, "
+	       << nbBorder << " on the border." << std::endl;
+  nbok += ( nbBorder > 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "some bels touch the border." << std::endl;
+
+  // Boundary tracking (uses CachedSurfelNeighborhood) must give
+  // back the component of the starting bel.
+  std::set<SCell> ball;
+  Point p = Point::diagonal( 0 );
+  p[ 0 ] = 4;
+  SCell bel = K.sIncident( K.sSpel( p, K.POS ), 0, true );
+  Surfaces<KSpace>::trackBoundary( ball, K, SAdj, shape, bel );
+  bool inside = true;
+  for ( typename std::set<SCell>::const_iterator it = ball.begin();
+	it != ball.end(); ++it )
+    inside = inside && ( bdry.find( *it ) != bdry.end() );
+  std::set<SCell> cball;
+  Surfaces<KSpace>::trackClosedBoundary( cball, K, SAdj, shape, bel );
+  nbok += ( inside && ( ball.size() > 0 ) && ( ball == cball ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "tracked " << ball.size() << " bels of the ball." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class CachedSurfelNeighborhood" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCachedSurfelNeighborhood< KhalimskySpaceND<2> >( true, 4096 )
+    && testCachedSurfelNeighborhood< KhalimskySpaceND<2> >( false, 4096 )
+    && testCachedSurfelNeighborhood< KhalimskySpaceND<3> >( true, 4096 )
+    && testCachedSurfelNeighborhood< KhalimskySpaceND<3> >( false, 4096 )
+    && testCachedSurfelNeighborhood< KhalimskySpaceND<3> >( true, 0 )
+    && testCachedSurfelNeighborhood< KhalimskySpaceND<3> >( false, 7 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
@@ -191,6 +193,268 @@ bool testCellularGridSpaceND()
 }
 
 
+/**
+ * Returns 'true' iff the two collections of cells contain the same
+ * cells, whatever their order.
+ */
+template <typename Collection1, typename Collection2>
+bool sameCells( const Collection1 & c1, const Collection2 & c2 )
+{
+  typedef typename Collection1::value_type Cell;
+  std::vector<Cell> v1( c1.begin(), c1.end() );
+  std::vector<Cell> v2( c2.begin(), c2.end() );
+  std::sort( v1.begin(), v1.end() );
+  std::sort( v2.begin(), v2.end() );
+  return v1 == v2;
+}
+
+/**
+ * Returns 'true' iff the collection contains no cell twice.
+ */
+template <typename Collection>
+bool noDuplicates( const Collection & c )
+{
+  typedef typename Collection::value_type Cell;
+  std::vector<Cell> v( c.begin(), c.end() );
+  std::sort( v.begin(), v.end() );
+  return std::adjacent_find( v.begin(), v.end() ) == v.end();
+}
+
+/**
+ * Checks that the allocation-free neighborhood and incidence
+ * services give the same cells as the services returning
+ * collections, for all the cells of a small space.
+ */
+template <typename KSpace>
+bool testLocalConfigurations()
+{
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing allocation-free local configurations ..." );
+  KSpace K;
+  Point low = Point::diagonal( -2 );
+  Point high = Point::diagonal( 2 );
+  K.init( low, high, true );
+  typename KSpace::NeighborhoodCells N;
+  typename KSpace::NeighborhoodSCells SN;
+  typename KSpace::IncidentCells I;
+  typename KSpace::IncidentSCells SI;
+  typename KSpace::FaceCells F;
+  Domain domain( low * 2, high * 2 + Point::diagonal( 2 ) );
+  unsigned int nbcells = 0;
+  unsigned int nbcofaces = 0;
+  for ( typename Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    {
+      Cell c = K.uCell( *it );
+      SCell sc = K.sCell( *it, ( nbcells % 2 ) == 0 );
+      bool ok = true;
+      K.uNeighborhood( c, N );
+      ok = ok && sameCells( N, K.uNeighborhood( c ) );
+      K.uProperNeighborhood( c, N );
+      ok = ok && sameCells( N, K.uProperNeighborhood( c ) );
+      K.sNeighborhood( sc, SN );
+      ok = ok && sameCells( SN, K.sNeighborhood( sc ) );
+      K.sProperNeighborhood( sc, SN );
+      ok = ok && sameCells( SN, K.sProperNeighborhood( sc ) );
+      K.uLowerIncident( c, I );
+      ok = ok && sameCells( I, K.uLowerIncident( c ) );
+      K.uUpperIncident( c, I );
+      ok = ok && sameCells( I, K.uUpperIncident( c ) );
+      K.sLowerIncident( sc, SI );
+      ok = ok && sameCells( SI, K.sLowerIncident( sc ) );
+      K.sUpperIncident( sc, SI );
+      ok = ok && sameCells( SI, K.sUpperIncident( sc ) );
+      K.uFaces( c, F );
+      ok = ok && sameCells( F, K.uFaces( c ) ) && noDuplicates( F );
+      ok = ok && ( F.size() + 1 == round( std::pow( 3.0, (int) K.uDim( c ) ) ) );
+      K.uCoFaces( c, F );
+      ok = ok && sameCells( F, K.uCoFaces( c ) ) && noDuplicates( F );
+      nbcofaces += F.size();
+      nbok += ok ? 1 : 0;
+      nb++;
+      ++nbcells;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "cells with identical local configurations." << std::endl;
+  // Every cell is a coface of as many cells as it has faces.
+  unsigned int nbfaces = 0;
+  for ( typename Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    {
+      K.uFaces( K.uCell( *it ), F );
+      nbfaces += F.size();
+    }
+  nbok += nbfaces == nbcofaces ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << nbfaces << " faces == " << nbcofaces << " cofaces" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that the parallel boundary extraction gives the same
+ * surfels as the sequential one, on a shape touching the space
+ * bounds.
+ */
+template <typename KSpace>
+bool testMakeBoundaryParallel()
+{
+  typedef typename KSpace::Integer Integer;
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef SpaceND< KSpace::dimension, Integer > Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing parallel boundary extraction ..." );
+  KSpace K;
+  Point low = Point::diagonal( -6 );
+  Point high = Point::diagonal( 5 );
+  high[ 0 ] = 8;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point::diagonal( 0 ), 4 );
+  Shapes<Domain>::addNorm1Ball( shape_set, high, 3 );
+  shape_set.insert( low );
+  SetPredicate<DigitalSet> shape_set_predicate( shape_set );
+  Cell low_spel = K.uSpel( low );
+  Cell high_spel = K.uSpel( high );
+
+  std::set<SCell> sbdry;
+  Surfaces<KSpace>::sMakeBoundary( sbdry, K, shape_set_predicate,
+				   low_spel, high_spel );
+  std::vector<SCell> sbdry2;
+  Surfaces<KSpace>::sMakeBoundaryParallel( sbdry2, K, shape_set_predicate,
+					   low_spel, high_spel );
+  nbok += ( sbdry.size() == sbdry2.size() ) && noDuplicates( sbdry2 )
+    && sameCells( sbdry2, std::vector<SCell>( sbdry.begin(), sbdry.end() ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << sbdry2.size() << " signed surfels == "
+	       << sbdry.size() << std::endl;
+  std::set<Cell> ubdry;
+  Surfaces<KSpace>::uMakeBoundary( ubdry, K, shape_set_predicate,
+				   low_spel, high_spel );
+  std::vector<Cell> ubdry2;
+  Surfaces<KSpace>::uMakeBoundaryParallel( ubdry2, K, shape_set_predicate,
+					   low_spel, high_spel );
+  nbok += ( ubdry.size() == ubdry2.size() ) && noDuplicates( ubdry2 )
+    && sameCells( ubdry2, std::vector<Cell>( ubdry.begin(), ubdry.end() ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << ubdry2.size() << " unsigned surfels == "
+	       << ubdry.size() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks the union-find extraction of boundary components against
+ * boundary tracking, on a shape made of a hollow ball, a ball and
+ * two isolated points.
+ */
+template <typename KSpace>
+bool testConnectedComponents()
+{
+  typedef typename KSpace::Integer Integer;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef SpaceND< KSpace::dimension, Integer > Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing extraction of all boundary components ..." );
+  KSpace K;
+  Point low = Point::diagonal( -8 );
+  Point high = Point::diagonal( 8 );
+  high[ 0 ] = 20;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point::diagonal( 0 ), 6 );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point::diagonal( 0 ), 3 );
+  Point c2 = Point::diagonal( 0 );
+  c2[ 0 ] = 14;
+  Shapes<Domain>::addNorm2Ball( shape_set, c2, 4 );
+  shape_set.insert( low );
+  shape_set.insert( high );
+  SetPredicate<DigitalSet> shape_set_predicate( shape_set );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+
+  std::vector<SCell> surfels;
+  std::vector<std::size_t> starts;
+  Surfaces<KSpace>::extractAllConnectedSCell( surfels, starts,
+					      K, SAdj, shape_set_predicate );
+  nbok += starts.size() == 6 ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << starts.size() - 1 << " components == 5" << std::endl;
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, shape_set_predicate,
+				   K.uSpel( low ), K.uSpel( high ) );
+  nbok += ( surfels.size() == bdry.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << surfels.size() << " surfels == " << bdry.size() << std::endl;
+  bool tracking_ok = true;
+  for ( std::size_t i = 0; i + 1 < starts.size(); ++i )
+    {
+      std::set<SCell> component;
+      Surfaces<KSpace>::trackBoundary( component, K, SAdj,
+				       shape_set_predicate, surfels[ starts[ i ] ] );
+      tracking_ok = tracking_ok
+	&& sameCells( std::vector<SCell>( component.begin(), component.end() ),
+		      std::vector<SCell>( surfels.begin() + starts[ i ],
+					  surfels.begin() + starts[ i + 1 ] ) );
+    }
+  nbok += tracking_ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "components are the tracked boundaries." << std::endl;
+  // The vector of components follows the order of the extraction
+  // by tracking in a std::set<SCell>.
+  std::vector< std::vector<SCell> > vectConnectedSCell;
+  Surfaces<KSpace>::extractAllConnectedSCell( vectConnectedSCell, K, SAdj,
+					      shape_set_predicate, true );
+  std::vector< std::vector<SCell> > expected;
+  while ( ! bdry.empty() )
+    {
+      std::set<SCell> component;
+      Surfaces<KSpace>::trackBoundary( component, K, SAdj,
+				       shape_set_predicate, *( bdry.begin() ) );
+      for ( typename std::set<SCell>::const_iterator it = component.begin();
+	    it != component.end(); ++it )
+	bdry.erase( *it );
+      expected.push_back( std::vector<SCell>( component.begin(),
+					      component.end() ) );
+      Surfaces<KSpace>::orientSCellExterior( expected.back(), K,
+					     shape_set_predicate );
+    }
+  nbok += ( vectConnectedSCell == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << vectConnectedSCell.size() << " components in std::set order."
+	       << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 template <typename KSpace>
 bool testSurfelAdjacency()
 {
@@ -407,6 +671,13 @@ int main( int argc, char** argv )
   bool res = testCellularGridSpaceND<K2>()
     && testCellularGridSpaceND<K3>()
     && testCellularGridSpaceND<K4>()
+    && testLocalConfigurations<K2>()
+    && testLocalConfigurations<K3>()
+    && testLocalConfigurations<K4>()
+    && testMakeBoundaryParallel<K2>()
+    && testMakeBoundaryParallel<K3>()
+    && testConnectedComponents<K2>()
+    && testConnectedComponents<K3>()
     && testSurfelAdjacency<K2>()
     && testSurfelAdjacency<K3>()
     && testSurfelAdjacency<K4>()
@@ -0,0 +1,158 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCodeHashTable.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/10/10
+ *
+ * Functions for testing class CodeHashTable.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellCoder.h"
+#include "DGtal/topology/CodeHashTable.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CodeHashTable.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef KhalimskySpaceND<3> KSpace;
+typedef KhalimskyCellCoder<KSpace> Coder;
+typedef Coder::Code Code;
+typedef CodeHashTable<Coder, unsigned int> Table;
+
+/**
+ * @return 'true' iff [t] and [m] contain the same codes and values.
+ */
+bool sameMap( const Table & t, const std::map<Code,unsigned int> & m )
+{
+  if ( t.size() != m.size() ) return false;
+  std::size_t n = 0;
+  for ( std::size_t s = t.nextUsedSlot( 0 ); s != t.capacity();
+	s = t.nextUsedSlot( s + 1 ), ++n )
+    {
+      std::map<Code,unsigned int>::const_iterator it = m.find( t.code( s ) );
+      if ( ( it == m.end() ) || ( it->second != t.value( s ) ) ) return false;
+    }
+  return n == m.size();
+}
+
+/**
+ * The predicate "code is odd".
+ */
+struct IsOdd
+{
+  bool operator()( Code code ) const { return ( code & 1 ) != 0; }
+};
+
+/**
+ * Random insertions and removals of codes with values, checked
+ * against std::map.
+ */
+bool testCodeHashTable()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing insert, find, erase and removeIf ..." );
+  Table table;
+  std::map<Code,unsigned int> m;
+  nbok += ( table.isValid() && table.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << table << std::endl;
+  // Few distinct codes, so that clusters and collisions are frequent.
+  bool insert_ok = true;
+  srand( 0 );
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      Code code = (Code) ( rand() % 30000 );
+      std::pair<std::size_t,bool> r = table.insert( code );
+      if ( r.second ) table.value( r.first ) = i;
+      insert_ok = insert_ok && ( r.second == ( m.find( code ) == m.end() ) );
+      if ( r.second ) m[ code ] = i;
+      insert_ok = insert_ok && ( table.find( code ) == r.first )
+	&& ( table.value( r.first ) == m[ code ] );
+    }
+  nbok += ( insert_ok && table.isValid() && sameMap( table, m ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "insertions: " << table << std::endl;
+  // Erasing moves values together with their codes.
+  bool erase_ok = true;
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      Code code = (Code) ( rand() % 30000 );
+      bool present = m.erase( code ) == 1;
+      erase_ok = erase_ok && ( table.erase( code ) == present )
+	&& ( table.find( code ) == table.capacity() );
+    }
+  nbok += ( erase_ok && sameMap( table, m ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "removals: " << table << std::endl;
+  std::size_t nbOdd = 0;
+  for ( std::map<Code,unsigned int>::iterator it = m.begin(); it != m.end(); )
+    if ( IsOdd()( it->first ) ) { m.erase( it++ ); ++nbOdd; }
+    else ++it;
+  std::size_t nbRemoved = table.removeIf( IsOdd() );
+  nbok += ( ( nbRemoved == nbOdd ) && table.isValid()
+	    && ( table.capacity() < 4 * table.size() + 16 )
+	    && sameMap( table, m ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "removeIf: " << nbRemoved << " odd codes, " << table << std::endl;
+  table.clear();
+  nbok += ( table.empty() && ( table.nextUsedSlot( 0 ) == table.capacity() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") clear." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class CodeHashTable" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCodeHashTable(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,7 @@
 #include "DGtal/topology/DigitalTopology.h"
 #include "DGtal/topology/Object.h"
 #include "DGtal/topology/Expander.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -170,6 +171,71 @@ bool testExpander()
 	       << " <= " << sqrt(2.0)*M_PI*radius << std::endl;
   trace.endBlock();
 
+  trace.beginBlock ( "Testing layers and core consistency ..." );
+  ObjectExpander expander3( ball, c );
+  bool consistent = true;
+  unsigned int nbVisited = 1;
+  while ( ! expander3.finished() )
+    {
+      const DigitalSet & layer = expander3.layer();
+      consistent = consistent 
+	&& ( layer.size() == expander3.layerSize() )
+	&& ( expander3.core().size() == nbVisited );
+      for ( ObjectExpander::PointConstIterator it = expander3.layerBegin();
+	    it != expander3.layerEnd(); ++it )
+	{
+	  Point v( *it - c );
+	  consistent = consistent
+	    && ( v.norm1() == expander3.distance() )
+	    && ( layer.find( *it ) != layer.end() )
+	    && ( expander3.core().find( *it ) == expander3.core().end() );
+	}
+      nbVisited += expander3.layerSize();
+      expander3.nextLayer();
+    }
+  INBLOCK_TEST( consistent );
+  INBLOCK_TEST( expander3.core().size() == ball.size() );
+  INBLOCK_TEST( nbVisited == ball.size() );
+  trace.endBlock();
+
+  trace.beginBlock ( "Testing geodesic distance map in the ball ..." );
+  typedef ImageContainerBySTLVector< Domain, unsigned int > DistanceImage;
+  const unsigned int far = 1000;
+  DistanceImage image( domain.lowerBound(), domain.upperBound() );
+  for ( DistanceImage::Iterator it = image.begin(); it != image.end(); ++it )
+    *it = far;
+  ObjectExpander expander4( ball, c );
+  expander4.writeDistances( image );
+  bool correct = true;
+  for ( DomainConstIterator it = domain.range().begin(); 
+	it != domain.range().end(); ++it )
+    correct = correct && ( ball_set.find( *it ) != ball_set.end()
+			   ? image( *it ) == ( *it - c ).norm1()
+			   : image( *it ) == far );
+  INBLOCK_TEST( correct );
+  for ( DistanceImage::Iterator it = image.begin(); it != image.end(); ++it )
+    *it = far;
+  ObjectExpander expander5( ball, c );
+  expander5.writeDistances( image, 4 );
+  unsigned int nbWritten = 0;
+  correct = true;
+  for ( DomainConstIterator it = domain.range().begin(); 
+	it != domain.range().end(); ++it )
+    if ( image( *it ) != far )
+      {
+	++nbWritten;
+	correct = correct && ( image( *it ) == ( *it - c ).norm1() )
+	  && ( image( *it ) <= 4 );
+      }
+  INBLOCK_TEST( correct );
+  INBLOCK_TEST( nbWritten == 129 );
+  ObjectExpander expander6( ball, c );
+  Point target( 3, 2, 0 );
+  IsWithinPointPredicate<Point> targetPred( target, target );
+  INBLOCK_TEST( expander6.writeDistances( image, 1000, targetPred ) );
+  INBLOCK_TEST( expander6.distance() == 5 );
+  trace.endBlock();
+
   
   return nbok == nb;
 }
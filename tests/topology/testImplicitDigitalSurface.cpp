@@ -0,0 +1,184 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImplicitDigitalSurface.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/13
+ *
+ * Functions for testing class ImplicitDigitalSurface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/CDigitalSurface.h"
+#include "DGtal/topology/ImplicitDigitalSurface.h"
+#include "DGtal/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImplicitDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A ball of given radius centered on the origin.
+ */
+template <typename TPoint>
+struct ImplicitBall {
+  typedef TPoint Point;
+  typedef typename Point::Coordinate Coordinate;
+  Coordinate r2;
+  ImplicitBall( Coordinate r = 0 ) : r2( r * r ) {}
+  bool operator()( const Point & p ) const
+  {
+    Coordinate n = 0;
+    for ( Dimension k = 0; k < Point::dimension; ++k )
+      n += p[ k ] * p[ k ];
+    return n <= r2;
+  }
+};
+
+/**
+ * Compares the implicit surface of a ball with its tracked boundary.
+ */
+template <typename KSpace>
+bool testImplicitDigitalSurface( bool cache )
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef ImplicitBall<Point> Ball;
+  typedef ImplicitDigitalSurface<KSpace, Ball> Surface;
+  typedef typename Surface::Neighbors Neighbors;
+  typedef typename Surfaces<KSpace>::SurfelSet SurfelSet;
+  BOOST_CONCEPT_ASSERT(( CDigitalSurface<Surface> ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImplicitDigitalSurface of a ball ..." );
+  KSpace K;
+  K.init( Point::diagonal( -8 ), Point::diagonal( 8 ), true );
+  Ball ball( 6 );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  Surface surface( K, ball, SAdj, cache ? 64 : 0 );
+  trace.info() << surface << std::endl;
+  SCell bel = Surfaces<KSpace>::findABel( K, ball, 10000 );
+  SurfelSet bdry;
+  Surfaces<KSpace>::trackBoundary( bdry, K, SAdj, ball, bel );
+  nbok += surface.isSurfel( bel ) && ! surface.isSurfel( K.sOpp( bel ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "bel is a surfel, not its opposite." << std::endl;
+  bool neighbors_ok = true;
+  Neighbors N;
+  for ( typename SurfelSet::ConstIterator it = bdry.begin(), itE = bdry.end();
+	it != itE; ++it )
+    {
+      surface.neighbors( N, *it );
+      neighbors_ok = neighbors_ok && surface.isSurfel( *it )
+	&& ( N.size() == 2 * ( KSpace::dimension - 1 ) )
+	&& ( surface.degree( *it ) == N.size() );
+      for ( typename Neighbors::ConstIterator nit = N.begin();
+	    nit != N.end(); ++nit )
+	neighbors_ok = neighbors_ok && ( bdry.count( *nit ) == 1 );
+    }
+  nbok += neighbors_ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "neighbors of " << bdry.size() << " tracked surfels." << std::endl;
+  std::vector<SCell> patch;
+  surface.ball( patch, bel, 1 );
+  nbok += ( patch.size() == 1 + 2 * ( KSpace::dimension - 1 ) )
+    && ( patch[ 0 ] ==  bel ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "ball of radius 1 has " << patch.size() << " surfels." << std::endl;
+  surface.ball( patch, bel, 1000 );
+  nbok += ( patch.size() == bdry.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "big ball is the whole boundary." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Local computations on the surface of a ball in a 1000^3 space,
+ * which is never tracked entirely.
+ */
+bool testHugeSurface()
+{
+  typedef KhalimskySpaceND<3> KSpace;
+  typedef KSpace::SCell SCell;
+  typedef KSpace::Point Point;
+  typedef ImplicitBall<Point> Ball;
+  typedef ImplicitDigitalSurface<KSpace, Ball> Surface;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImplicitDigitalSurface of a huge ball ..." );
+  KSpace K;
+  K.init( Point::diagonal( -500 ), Point::diagonal( 499 ), true );
+  Ball ball( 450 );
+  SurfelAdjacency<3> SAdj( true );
+  Surface surface( K, ball, SAdj, 1 << 12 );
+  SCell bel = K.sIncident( K.sSpel( Point( 450, 0, 0 ), K.POS ), 0, true );
+  std::vector<SCell> patch;
+  surface.ball( patch, bel, 20 );
+  bool ok = surface.isSurfel( bel );
+  for ( unsigned int i = 0; i < patch.size(); ++i )
+    ok = ok && surface.isSurfel( patch[ i ] );
+  nbok += ( ok && ( patch.size() > 400 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "ball of radius 20 has " << patch.size() << " surfels."
+	       << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImplicitDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testImplicitDigitalSurface< KhalimskySpaceND<2> >( false )
+    && testImplicitDigitalSurface< KhalimskySpaceND<3> >( false )
+    && testImplicitDigitalSurface< KhalimskySpaceND<3> >( true )
+    && testHugeSurface();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,205 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKhalimskyCellCoder.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/09
+ *
+ * Functions for testing class KhalimskyCellCoder.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellCoder.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class KhalimskyCellCoder.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Lexicographic order starting from the last coordinate, then the
+ * sign (positive first).
+ */
+template <typename SCell>
+bool reverseLess( const SCell & c1, const SCell & c2 )
+{
+  for ( Dimension k = SCell::Point::dimension; k-- > 0; )
+    {
+      if ( c1.myCoordinates[ k ] < c2.myCoordinates[ k ] ) return true;
+      if ( c2.myCoordinates[ k ] < c1.myCoordinates[ k ] ) return false;
+    }
+  return c1.myPositive && ! c2.myPositive;
+}
+
+/**
+ * Checks that encoding, decoding, ordering and incidence on codes
+ * agree with the space, for all the cells of a small space.
+ */
+template <typename KSpace>
+bool testKhalimskyCellCoder( bool closed )
+{
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef KhalimskyCellCoder<KSpace> Coder;
+  typedef typename Coder::Code Code;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing cell codes ..." );
+  KSpace K;
+  Point low = Point::diagonal( -3 );
+  Point high = Point::diagonal( 2 );
+  high[ 0 ] = 7;
+  K.init( low, high, closed );
+  Coder coder( K );
+  trace.info() << coder << " closed=" << closed << std::endl;
+  nbok += coder.isValid() ? 1 : 0;
+  nb++;
+  Domain domain( K.lowerCell().myCoordinates, K.upperCell().myCoordinates );
+  bool codes_ok = true;
+  bool order_ok = true;
+  bool topology_ok = true;
+  bool incidence_ok = true;
+  SCell previous;
+  Code previousCode = 0;
+  bool first = true;
+  for ( typename Domain::ConstIterator it = domain.begin();
+	it != domain.end(); ++it )
+    {
+      Cell c = K.uCell( *it );
+      Code uc = coder.uCode( c );
+      codes_ok = codes_ok && ( coder.uCell( uc ) == c );
+      for ( int s = 0; s < 2; ++s )
+	{
+	  SCell sc = K.signs( c, s == 0 );
+	  Code code = coder.sCode( sc );
+	  codes_ok = codes_ok && ( coder.sCell( code ) == sc )
+	    && ( Coder::unsigns( code ) == uc )
+	    && ( Coder::sSign( code ) == K.sSign( sc ) )
+	    && ( coder.sCell( Coder::sOpp( code ) ) == K.sOpp( sc ) );
+	  if ( ! first )
+	    order_ok = order_ok
+	      && ( reverseLess( previous, sc ) == ( previousCode < code ) );
+	  previous = sc;
+	  previousCode = code;
+	  first = false;
+	  topology_ok = topology_ok && ( coder.dim( code ) == K.sDim( sc ) );
+	  for ( Dimension k = 0; k < K.dimension; ++k )
+	    {
+	      topology_ok = topology_ok
+		&& ( coder.isOpen( code, k ) == K.sIsOpen( sc, k ) );
+	      if ( K.sKCoord( sc, k ) < K.upperCell().myCoordinates[ k ] )
+		incidence_ok = incidence_ok
+		  && ( coder.sCell( coder.sIncident( code, k, true ) )
+		       == K.sIncident( sc, k, true ) )
+		  && ( coder.uCell( coder.uIncident( uc, k, true ) )
+		       == K.uIncident( c, k, true ) );
+	      if ( K.lowerCell().myCoordinates[ k ] < K.sKCoord( sc, k ) )
+		incidence_ok = incidence_ok
+		  && ( coder.sCell( coder.sIncident( code, k, false ) )
+		       == K.sIncident( sc, k, false ) );
+	      if ( ! K.sIsMax( sc, k ) )
+		incidence_ok = incidence_ok
+		  && ( coder.sCell( coder.adjacent( code, k, true ) )
+		       == K.sGetIncr( sc, k ) );
+	    }
+	}
+    }
+  nbok += codes_ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "encoding and decoding of cells." << std::endl;
+  nbok += order_ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "order of codes is the scanning order of cells." << std::endl;
+  nbok += topology_ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "topology of cells from codes." << std::endl;
+  nbok += incidence_ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "incidence and adjacency on codes." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that too large spaces are detected.
+ */
+bool testLargeSpace()
+{
+  typedef KhalimskySpaceND<3, DGtal::int64_t> KSpace;
+  typedef KSpace::Point Point;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing space size limits ..." );
+  KSpace K;
+  K.init( Point::diagonal( 0 ), Point::diagonal( ( 1 << 20 ) - 2 ), true );
+  KhalimskyCellCoder<KSpace> coder( K );
+  nbok += coder.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << coder << std::endl;
+  K.init( Point::diagonal( 0 ), Point::diagonal( 1 << 21 ), true );
+  coder.init( K );
+  nbok += ! coder.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << coder << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class KhalimskyCellCoder" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testKhalimskyCellCoder< KhalimskySpaceND<2> >( true )
+    && testKhalimskyCellCoder< KhalimskySpaceND<2> >( false )
+    && testKhalimskyCellCoder< KhalimskySpaceND<3> >( true )
+    && testKhalimskyCellCoder< KhalimskySpaceND<3> >( false )
+    && testKhalimskyCellCoder< KhalimskySpaceND<4> >( true )
+    && testLargeSpace();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,172 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testKhalimskySpaceND-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/07
+ *
+ * Benchmarks the neighborhood and incidence services of
+ * KhalimskySpaceND: collections (std::deque) versus fixed-capacity
+ * arrays, over all the cells of a 256^3 space (the size may be given
+ * as first argument).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<3> KSpace;
+typedef KSpace::Cell Cell;
+typedef KSpace::SCell SCell;
+typedef KSpace::Point Point;
+
+/**
+ * Visits all the cells of [K] in Khalimsky coordinates order and
+ * calls [f] on each of them. Returns the sum of the values returned
+ * by [f], so that the computations cannot be optimized away.
+ */
+template <typename Functor>
+unsigned long long
+visitAllCells( const KSpace & K, Functor & f )
+{
+  unsigned long long total = 0;
+  // Khalimsky coordinates of the lowest and uppermost cells of K.
+  Point low = K.lowerBound() + K.lowerBound();
+  Point up = K.upperBound() + K.upperBound() + Point::diagonal( 2 );
+  Cell c = K.uCell( low );
+  for ( c.myCoordinates[ 2 ] = low[ 2 ];
+	c.myCoordinates[ 2 ] <= up[ 2 ]; ++c.myCoordinates[ 2 ] )
+    for ( c.myCoordinates[ 1 ] = low[ 1 ];
+	  c.myCoordinates[ 1 ] <= up[ 1 ]; ++c.myCoordinates[ 1 ] )
+      for ( c.myCoordinates[ 0 ] = low[ 0 ];
+	    c.myCoordinates[ 0 ] <= up[ 0 ]; ++c.myCoordinates[ 0 ] )
+	total += f( c );
+  return total;
+}
+
+struct NeighborhoodDeque {
+  const KSpace & K;
+  NeighborhoodDeque( const KSpace & aK ) : K( aK ) {}
+  unsigned int operator()( const Cell & c )
+  { return K.uNeighborhood( c ).size(); }
+};
+struct NeighborhoodArray {
+  const KSpace & K;
+  KSpace::NeighborhoodCells N;
+  NeighborhoodArray( const KSpace & aK ) : K( aK ) {}
+  unsigned int operator()( const Cell & c )
+  { K.uNeighborhood( c, N ); return N.size(); }
+};
+struct IncidenceDeque {
+  const KSpace & K;
+  IncidenceDeque( const KSpace & aK ) : K( aK ) {}
+  unsigned int operator()( const Cell & c )
+  {
+    SCell s = K.signs( c, K.POS );
+    return K.uLowerIncident( c ).size() + K.uUpperIncident( c ).size()
+      + K.sLowerIncident( s ).size() + K.sUpperIncident( s ).size();
+  }
+};
+struct IncidenceArray {
+  const KSpace & K;
+  KSpace::IncidentCells N;
+  KSpace::IncidentSCells SN;
+  IncidenceArray( const KSpace & aK ) : K( aK ) {}
+  unsigned int operator()( const Cell & c )
+  {
+    SCell s = K.signs( c, K.POS );
+    unsigned int n = 0;
+    K.uLowerIncident( c, N );  n += N.size();
+    K.uUpperIncident( c, N );  n += N.size();
+    K.sLowerIncident( s, SN ); n += SN.size();
+    K.sUpperIncident( s, SN ); n += SN.size();
+    return n;
+  }
+};
+struct FacesDeque {
+  const KSpace & K;
+  FacesDeque( const KSpace & aK ) : K( aK ) {}
+  unsigned int operator()( const Cell & c )
+  { return K.uFaces( c ).size() + K.uCoFaces( c ).size(); }
+};
+struct FacesArray {
+  const KSpace & K;
+  KSpace::FaceCells N;
+  FacesArray( const KSpace & aK ) : K( aK ) {}
+  unsigned int operator()( const Cell & c )
+  {
+    unsigned int n = 0;
+    K.uFaces( c, N );   n += N.size();
+    K.uCoFaces( c, N ); n += N.size();
+    return n;
+  }
+};
+
+/**
+ * Runs the collection-based and array-based versions of a service
+ * and checks that they visit the same number of cells.
+ */
+template <typename DequeFunctor, typename ArrayFunctor>
+bool compare( const KSpace & K, const std::string & name )
+{
+  DequeFunctor fd( K );
+  ArrayFunctor fa( K );
+  trace.beginBlock( name + " (std::deque)" );
+  unsigned long long nd = visitAllCells( K, fd );
+  trace.info() << nd << " cells enumerated." << std::endl;
+  trace.endBlock();
+  trace.beginBlock( name + " (fixed-capacity array)" );
+  unsigned long long na = visitAllCells( K, fa );
+  trace.info() << na << " cells enumerated." << std::endl;
+  trace.endBlock();
+  return nd == na;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking KhalimskySpaceND local configurations" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  int size = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 256;
+  KSpace K;
+  K.init( Point::diagonal( 0 ), Point::diagonal( size - 1 ), true );
+  bool res = compare<NeighborhoodDeque, NeighborhoodArray>( K, "Neighborhoods" )
+    && compare<IncidenceDeque, IncidenceArray>( K, "Incident cells" )
+    && compare<FacesDeque, FacesArray>( K, "Faces and cofaces" );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
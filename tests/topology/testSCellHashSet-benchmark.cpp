@@ -0,0 +1,113 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSCellHashSet-benchmark.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/11
+ *
+ * Benchmarks boundary tracking (Surfaces::trackBoundary and
+ * Surfaces::trackClosedBoundary) in a std::set<SCell> versus a
+ * SCellHashSet, on the boundary of a ball of radius 100 (the radius
+ * may be given as first argument).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SCellHashSet.h"
+#include "DGtal/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef KhalimskySpaceND<3> KSpace;
+typedef KSpace::SCell SCell;
+typedef KSpace::Point Point;
+
+/**
+ * The digital ball of radius [r] centered on the origin, as a
+ * model of CPointPredicate (so that the benchmark measures the set
+ * of surfels, not a digital set).
+ */
+struct BallPredicate {
+  typedef KSpace::Point Point;
+  Point::Coordinate r2;
+  BallPredicate( Point::Coordinate r ) : r2( r * r ) {}
+  bool operator()( const Point & p ) const
+  { return p[ 0 ] * p[ 0 ] + p[ 1 ] * p[ 1 ] + p[ 2 ] * p[ 2 ] <= r2; }
+};
+
+/**
+ * Tracks the boundary of [pp] from [bel] into [surface], with or
+ * without following indirect orientations.
+ */
+template <typename SCellSet>
+std::size_t track( SCellSet & surface, const std::string & name,
+		   const KSpace & K, const BallPredicate & pp,
+		   const SCell & bel, bool closed )
+{
+  SurfelAdjacency<3> SAdj( true );
+  trace.beginBlock( name );
+  if ( closed )
+    Surfaces<KSpace>::trackClosedBoundary( surface, K, SAdj, pp, bel );
+  else
+    Surfaces<KSpace>::trackBoundary( surface, K, SAdj, pp, bel );
+  trace.info() << surface.size() << " surfels." << std::endl;
+  trace.endBlock();
+  return surface.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking surfel sets for boundary tracking" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  int radius = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 100;
+  KSpace K;
+  K.init( Point::diagonal( -radius - 2 ), Point::diagonal( radius + 2 ), true );
+  BallPredicate pp( radius );
+  // The surfel between the rightmost spel of the ball and its outside.
+  SCell bel = K.sIncident( K.sSpel( Point( radius, 0, 0 ), K.POS ), 0, true );
+  std::set<SCell> sset;
+  Surfaces<KSpace>::SurfelSet hset;
+  std::size_t n1 = track( sset, "trackBoundary (std::set)", K, pp, bel, false );
+  std::size_t n2 = track( hset, "trackBoundary (SCellHashSet)", K, pp, bel, false );
+  std::size_t n3 = track( sset, "trackClosedBoundary (std::set)", K, pp, bel, true );
+  std::size_t n4 = track( hset, "trackClosedBoundary (SCellHashSet)", K, pp, bel, true );
+  bool res = ( n1 == n2 ) && ( n3 == n4 ) && ( n1 == n3 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,268 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSCellHashSet.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/11
+ *
+ * Functions for testing class SCellHashSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/SCellHashSet.h"
+#include "DGtal/helpers/Shapes.h"
+#include "DGtal/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SCellHashSet.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return 'true' iff [s1] and [s2] contain the same cells.
+ */
+template <typename HashSet>
+bool sameSet( const HashSet & s1, const std::set<typename HashSet::SCell> & s2 )
+{
+  if ( s1.size() != s2.size() ) return false;
+  std::size_t n = 0;
+  for ( typename HashSet::ConstIterator it = s1.begin(), itE = s1.end();
+	it != itE; ++it, ++n )
+    if ( s2.find( *it ) == s2.end() ) return false;
+  return n == s2.size();
+}
+
+/**
+ * Random insertions and removals of cells, checked against std::set.
+ */
+template <typename KSpace>
+bool testSetServices()
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef SCellHashSet<KSpace> HashSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing insert, find and erase ..." );
+  KSpace K;
+  K.init( Point::diagonal( -10 ), Point::diagonal( 10 ), true );
+  HashSet hset( K );
+  std::set<SCell> sset;
+  nbok += ( hset.isValid() && hset.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << hset << std::endl;
+  bool insert_ok = true;
+  srand( 0 );
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      Point p;
+      for ( Dimension k = 0; k < K.dimension; ++k )
+	p[ k ] = 2 * K.min( k ) + ( rand() % ( 2 * K.size( k ) + 1 ) );
+      SCell c = K.sCell( p, ( rand() % 2 ) == 0 );
+      bool added = hset.insert( c ).second;
+      insert_ok = insert_ok && ( added == sset.insert( c ).second )
+	&& ( hset.find( c ) != hset.end() ) && ( *hset.find( c ) == c )
+	&& ( hset.count( K.sOpp( c ) ) == sset.count( K.sOpp( c ) ) );
+    }
+  nbok += ( insert_ok && sameSet( hset, sset ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "insertions: " << hset << std::endl;
+  // Removes one cell out of two, then some absent cells.
+  std::vector<SCell> cells( sset.begin(), sset.end() );
+  bool erase_ok = true;
+  for ( unsigned int i = 0; i < cells.size(); i += 2 )
+    {
+      sset.erase( cells[ i ] );
+      erase_ok = erase_ok && ( hset.erase( cells[ i ] ) == 1 )
+	&& ( hset.erase( cells[ i ] ) == 0 );
+    }
+  for ( unsigned int i = 1; i < cells.size(); i += 2 )
+    erase_ok = erase_ok && ( hset.count( cells[ i ] ) == 1 );
+  nbok += ( erase_ok && sameSet( hset, sset ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "removals: " << hset << std::endl;
+  HashSet hset2( hset );
+  hset.clear();
+  nbok += ( hset.empty() && ( hset.begin() == hset.end() )
+	    && sameSet( hset2, sset ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "copy and clear." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Boundary tracking in a SCellHashSet and in a std::set.
+ */
+template <typename KSpace>
+bool testTracking()
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename DigitalSetSelector<Domain, BIG_DS+HIGH_BEL_DS>::Type DigitalSet;
+  typedef typename Surfaces<KSpace>::SurfelSet SurfelSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing boundary tracking in SurfelSet ..." );
+  Point low = Point::diagonal( -8 );
+  Point high = Point::diagonal( 8 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point::diagonal( 0 ), 6 );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point::diagonal( 0 ), 3 );
+  SetPredicate<DigitalSet> pp( shape_set );
+  SurfelAdjacency<KSpace::dimension> SAdj( true );
+  SCell bel = Surfaces<KSpace>::findABel( K, pp, 10000 );
+  SurfelSet hset;
+  std::set<SCell> sset;
+  Surfaces<KSpace>::trackBoundary( hset, K, SAdj, pp, bel );
+  Surfaces<KSpace>::trackBoundary( sset, K, SAdj, pp, bel );
+  nbok += ( hset.isValid() && ! hset.empty() && sameSet( hset, sset ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "trackBoundary: " << hset.size() << " surfels." << std::endl;
+  Surfaces<KSpace>::trackClosedBoundary( hset, K, SAdj, pp, bel );
+  Surfaces<KSpace>::trackClosedBoundary( sset, K, SAdj, pp, bel );
+  nbok += sameSet( hset, sset ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "trackClosedBoundary: " << hset.size() << " surfels."
+	       << std::endl;
+  // A space too large for cell codes must be rejected.
+  KSpace bigK;
+  bigK.init( Point::diagonal( -( 1 << 28 ) ), Point::diagonal( 1 << 28 ), true );
+  bool caught = false;
+  try
+    {
+      Surfaces<KSpace>::trackBoundary( hset, bigK, SAdj, pp, bel );
+    }
+  catch ( InputException & e )
+    {
+      caught = true;
+    }
+  nbok += caught ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "too large space throws InputException" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Contour extraction in 2D must not depend on the set of surfels.
+ */
+bool testContours()
+{
+  typedef KhalimskySpaceND<2> KSpace;
+  typedef KSpace::SCell SCell;
+  typedef KSpace::Point Point;
+  typedef KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef DigitalSetSelector<Domain, BIG_DS+HIGH_BEL_DS>::Type DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing 2D contour extraction ..." );
+  Point low( -20, -20 );
+  Point high( 20, 20 );
+  KSpace K;
+  K.init( low, high, true );
+  Domain domain( low, high );
+  DigitalSet shape_set( domain );
+  Shapes<Domain>::addNorm2Ball( shape_set, Point( -8, -8 ), 7 );
+  Shapes<Domain>::removeNorm2Ball( shape_set, Point( -8, -8 ), 3 );
+  Shapes<Domain>::addNorm1Ball( shape_set, Point( 10, 9 ), 6 );
+  SetPredicate<DigitalSet> pp( shape_set );
+  SurfelAdjacency<2> SAdj( true );
+  std::vector< std::vector<SCell> > contours;
+  Surfaces<KSpace>::extractAll2DSCellContours( contours, K, SAdj, pp );
+  nbok += ( contours.size() == 3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << contours.size() << " contours." << std::endl;
+  // Each contour is tracked from the smallest remaining surfel.
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, pp,
+				   K.uFirst( K.uSpel( low ) ),
+				   K.uLast( K.uSpel( high ) ) );
+  bool order_ok = true;
+  std::size_t n = 0;
+  for ( unsigned int i = 0; i < contours.size(); ++i )
+    {
+      order_ok = order_ok
+	&& ( std::find( contours[ i ].begin(), contours[ i ].end(),
+			*bdry.begin() ) != contours[ i ].end() );
+      n += contours[ i ].size();
+      for ( unsigned int j = 0; j < contours[ i ].size(); ++j )
+	bdry.erase( contours[ i ][ j ] );
+    }
+  nbok += ( order_ok && bdry.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << n << " surfels, contours in std::set order." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SCellHashSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSetServices< KhalimskySpaceND<2> >()
+    && testSetServices< KhalimskySpaceND<3> >()
+    && testTracking< KhalimskySpaceND<3> >()
+    && testContours();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,188 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfelGraph.cpp
+ * @ingroup Tests
+ * @author Jacques-Olivier Lachaud (\c jacques-olivier.lachaud@univ-savoie.fr )
+ * Laboratory of Mathematics (CNRS, UMR 5807), University of Savoie, France
+ *
+ * @date 2011/09/17
+ *
+ * Functions for testing class SurfelGraph.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/topology/ImplicitDigitalSurface.h"
+#include "DGtal/topology/SurfelGraph.h"
+#include "DGtal/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfelGraph.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Two disjoint balls of radius 4, the second one being shifted along
+ * the first axis.
+ */
+template <typename TPoint>
+struct TwoBalls {
+  typedef TPoint Point;
+  typedef typename Point::Coordinate Coordinate;
+  bool operator()( const Point & p ) const
+  {
+    Coordinate n1 = 0;
+    Coordinate n2 = 0;
+    for ( Dimension k = 0; k < Point::dimension; ++k )
+      {
+	Coordinate x = ( k == 0 ) ? p[ k ] - 12 : p[ k ];
+	n1 += p[ k ] * p[ k ];
+	n2 += x * x;
+      }
+    return ( n1 <= 16 ) || ( n2 <= 16 );
+  }
+};
+
+/**
+ * Compares the graph of the boundary of two balls with the
+ * neighbors given by ImplicitDigitalSurface.
+ */
+template <typename KSpace>
+bool testSurfelGraph( bool interior )
+{
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::Point Point;
+  typedef TwoBalls<Point> Shape;
+  typedef SurfelGraph<KSpace> Graph;
+  typedef typename Graph::Index Index;
+  typedef ImplicitDigitalSurface<KSpace, Shape> Surface;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SurfelGraph of two balls ..." );
+  KSpace K;
+  K.init( Point::diagonal( -6 ), Point::diagonal( 17 ), true );
+  Shape shape;
+  SurfelAdjacency<KSpace::dimension> SAdj( interior );
+  std::set<SCell> bdry;
+  Surfaces<KSpace>::sMakeBoundary( bdry, K, shape,
+				   K.uSpel( K.lowerBound() ),
+				   K.uSpel( K.upperBound() ) );
+  Graph graph;
+  graph.init( K, SAdj, bdry.begin(), bdry.end() );
+  trace.info() << graph << std::endl;
+  nbok += ( graph.isValid() && ( graph.size() == bdry.size() )
+	    && ( graph.nbArcs() == 2 * ( KSpace::dimension - 1 ) * graph.size() ) )
+    ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "all the bels, each one with 2(d-1) neighbors." << std::endl;
+
+  Surface surface( K, shape, SAdj );
+  typename Surface::Neighbors N;
+  bool same = true;
+  bool symmetric = true;
+  for ( Index i = 0; i < graph.size(); ++i )
+    {
+      same = same && ( graph.index( graph.surfel( i ) ) == i );
+      surface.neighbors( N, graph.surfel( i ) );
+      same = same && ( N.size() == graph.degree( i ) );
+      const Index* it = graph.neighborsBegin( i );
+      for ( typename Surface::Neighbors::ConstIterator itN = N.begin();
+	    same && ( itN != N.end() ); ++itN, ++it )
+	same = ( graph.surfel( *it ) == *itN );
+      for ( it = graph.neighborsBegin( i ); it != graph.neighborsEnd( i ); ++it )
+	symmetric = symmetric
+	  && ( std::find( graph.neighborsBegin( *it ), graph.neighborsEnd( *it ),
+			  i ) != graph.neighborsEnd( *it ) );
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "same neighbors as ImplicitDigitalSurface." << std::endl;
+  nbok += symmetric ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "symmetric adjacency." << std::endl;
+
+  // Counts the connected components by sweeping the arrays.
+  std::vector<Index> label( graph.size() );
+  for ( Index i = 0; i < graph.size(); ++i ) label[ i ] = i;
+  bool changed = true;
+  while ( changed )
+    {
+      changed = false;
+      for ( Index i = 0; i < graph.size(); ++i )
+	for ( const Index* it = graph.neighborsBegin( i );
+	      it != graph.neighborsEnd( i ); ++it )
+	  if ( label[ *it ] < label[ i ] )
+	    {
+	      label[ i ] = label[ *it ];
+	      changed = true;
+	    }
+    }
+  unsigned int nbComponents = 0;
+  for ( Index i = 0; i < graph.size(); ++i )
+    nbComponents += ( label[ i ] == i ) ? 1 : 0;
+  nbok += ( nbComponents == 2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << nbComponents << " components." << std::endl;
+
+  graph.clear();
+  nbok += ( graph.isValid() && ( graph.size() == 0 )
+	    && ( graph.nbArcs() == 0 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "cleared graph." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SurfelGraph" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSurfelGraph< KhalimskySpaceND<2> >( true )
+    && testSurfelGraph< KhalimskySpaceND<2> >( false )
+    && testSurfelGraph< KhalimskySpaceND<3> >( true )
+    && testSurfelGraph< KhalimskySpaceND<3> >( false );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -45,6 +45,7 @@
 
 //Estimators
 #include "DGtal/geometry/2d/BinomialConvolver.h"
+#include "DGtal/geometry/2d/estimators/BatchContourEstimator.h"
 
 
 #include <boost/program_options/options_description.hpp>
@@ -101,38 +102,39 @@ int main( int argc, char** argv )
     typedef Storage::const_iterator ConstIteratorOnPoints; 
 
     vector< FreemanChain > vectFcs =  PointListReader< Point >:: getFreemanChainsFromFile<Integer> (fileName); 
-   
+
+    // Binomial
+    typedef BinomialConvolver<ConstIteratorOnPoints, double> MyBinomialConvolver;
+    typedef CurvatureFromBinomialConvolverFunctor< MyBinomialConvolver, double >
+      CurvatureBCFct;
+    typedef BinomialConvolverEstimator< MyBinomialConvolver, CurvatureBCFct> 
+      BCCurvatureEstimator;
+    BatchContourEstimator<BCCurvatureEstimator> batch( h );
+    batch.init( vectFcs );
+    vector <double> curvatures( batch.nbValues() ); 
+    batch.eval( vectFcs, curvatures.begin() ); 
 
     for(unsigned int i=0; i<vectFcs.size(); i++){
 
-      bool isClosed = vectFcs.at(i).isClosed(); 
+      bool isClosed = batch.isClosed( i ); 
       cout << "# grid curve " << i+1 << "/" << vectFcs.size() << " "
       << ( (isClosed)?"closed":"open" ) << endl;
 
-      Storage vectPts; 
-      FreemanChain::getContourPoints( vectFcs.at(i), vectPts ); 
+      // The mask size only depends on the bounding box of the contour.
+      Storage corners; 
+      corners.push_back( batch.lowerBound( i ) ); 
+      corners.push_back( batch.upperBound( i ) ); 
+      unsigned int nbPts = batch.offset( i+1 ) - batch.offset( i ); 
 
-      // Binomial
       std::cout << "# Curvature estimation from binomial convolution" << std::endl;
-      typedef BinomialConvolver<ConstIteratorOnPoints, double> MyBinomialConvolver;
       std::cout << "# mask size = " << 
-      MyBinomialConvolver::suggestedSize( h, vectPts.begin(), vectPts.end() ) << std::endl;
-      typedef CurvatureFromBinomialConvolverFunctor< MyBinomialConvolver, double >
-      CurvatureBCFct;
-      BinomialConvolverEstimator< MyBinomialConvolver, CurvatureBCFct> BCCurvatureEstimator;
-
-      BCCurvatureEstimator.init( h, vectPts.begin(), vectPts.end(), isClosed );
-
-      vector <double> curvatures( vectPts.size() ); 
-      BCCurvatureEstimator.eval( vectPts.begin(), vectPts.end(), curvatures.begin() ); 
+      MyBinomialConvolver::suggestedSize( h, corners.begin(), corners.end() ) << std::endl;
 
       // Output
       cout << "# id curvature" << endl;  
-      unsigned int j = 0;
-      for ( ConstIteratorOnPoints it = vectPts.begin(), it_end = vectPts.end();
-	    it != it_end; ++it, ++j ) {
+      for ( unsigned int j = 0; j < nbPts; ++j ) {
 	cout << j << setprecision( 15 )
-	     << " " << curvatures[ j ] << endl;
+	     << " " << curvatures[ batch.offset( i ) + j ] << endl;
       }
 
    }
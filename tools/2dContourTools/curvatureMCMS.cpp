@@ -46,6 +46,7 @@
 //Estimators
 #include "DGtal/geometry/2d/MostCenteredMaximalSegmentEstimator.h"
 #include "DGtal/geometry/2d/SegmentComputerFunctor.h"
+#include "DGtal/geometry/2d/estimators/BatchContourEstimator.h"
 
 
 #include <boost/program_options/options_description.hpp>
@@ -103,45 +104,36 @@ int main( int argc, char** argv )
     typedef Storage::const_iterator ConstIteratorOnPoints; 
 
     vector< FreemanChain > vectFcs =  PointListReader< Point >:: getFreemanChainsFromFile<Integer> (fileName); 
-   
+
+    // Maximal segments
+    typedef ArithmeticalDSS<ConstIteratorOnPoints,Integer,4> SegmentComputer;
+    typedef CurvatureFromDSSLengthFunctor<SegmentComputer> Functor1;
+    typedef CurvatureFromDSSFunctor<SegmentComputer> Functor2;
+    typedef MostCenteredMaximalSegmentEstimator<SegmentComputer,Functor1> Estimator1;
+    typedef MostCenteredMaximalSegmentEstimator<SegmentComputer,Functor2> Estimator2;
+    BatchContourEstimator<Estimator1> batch1( h, true );
+    BatchContourEstimator<Estimator2> batch2( h, true );
+    batch1.init( vectFcs );
+    batch2.init( vectFcs );
+    vector <Functor1::Value> curvatures1( batch1.nbValues() ); 
+    batch1.eval( vectFcs, curvatures1.begin() ); 
+    vector <Functor2::Value> curvatures2( batch2.nbValues() ); 
+    batch2.eval( vectFcs, curvatures2.begin() ); 
 
     for(unsigned int i=0; i<vectFcs.size(); i++){
 
-      bool isClosed = vectFcs.at(i).isClosed(); 
+      bool isClosed = batch1.isClosed( i ); 
       cout << "# grid curve " << i+1 << "/" << vectFcs.size() << " "
       << ( (isClosed)?"closed":"open" ) << endl;
 
-      Storage vectPts; 
-      FreemanChain::getContourPoints( vectFcs.at(i), vectPts );
-      if (isClosed) vectPts.pop_back();  
-
-      // Binomial
       std::cout << "# Curvature estimation from maximal segments" << std::endl; 
-      typedef ArithmeticalDSS<ConstIteratorOnPoints,Integer,4> SegmentComputer;
-      typedef CurvatureFromDSSLengthFunctor<SegmentComputer> Functor1;
-      typedef CurvatureFromDSSFunctor<SegmentComputer> Functor2;
-      typedef MostCenteredMaximalSegmentEstimator<SegmentComputer,Functor1> Estimator1;
-      typedef MostCenteredMaximalSegmentEstimator<SegmentComputer,Functor2> Estimator2;
-      SegmentComputer sc;
-      Functor1 f1; 
-      Functor2 f2;
-      Estimator1 CurvatureEstimator1(sc, f1); 
-      Estimator2 CurvatureEstimator2(sc, f2); 
-      CurvatureEstimator1.init( h, vectPts.begin(), vectPts.end(), isClosed );
-      CurvatureEstimator2.init( h, vectPts.begin(), vectPts.end(), isClosed );
-      vector <Functor1::Value> curvatures1( vectPts.size() ); 
-      CurvatureEstimator1.eval( vectPts.begin(), vectPts.end(), curvatures1.begin() ); 
-      vector <Functor2::Value> curvatures2( vectPts.size() ); 
-      CurvatureEstimator2.eval( vectPts.begin(), vectPts.end(), curvatures2.begin() ); 
 
       // Output
       cout << "# id curvatureFromLength curvatureFromLengthAndWidth" << endl;  
-      unsigned int j = 0;
-      for ( ConstIteratorOnPoints it = vectPts.begin(), it_end = vectPts.end();
-	    it != it_end; ++it, ++j ) {
+      for ( unsigned int j = 0; j < batch1.offset( i+1 ) - batch1.offset( i ); ++j ) {
 	       cout << j << setprecision( 15 )
-	       << " " << curvatures1[ j ]
-	       << " " << curvatures2[ j ] << endl;
+	       << " " << curvatures1[ batch1.offset( i ) + j ]
+	       << " " << curvatures2[ batch2.offset( i ) + j ] << endl;
       }
 
    }
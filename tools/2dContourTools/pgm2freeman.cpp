@@ -50,6 +50,7 @@
 
 #include "DGtal/io/boards/Board2D.h"
 #include "DGtal/helpers/Surfaces.h"
+#include "DGtal/helpers/RasterContourExtractor.h"
 
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/parsers.hpp>
@@ -171,8 +172,8 @@ int main( int argc, char** argv )
     SurfelAdjacency<2> sAdj( true );
   
     std::vector< std::vector< Z2i::Point >  >  vectContoursBdryPointels;
-    Surfaces<Z2i::KSpace>::extractAllPointContours4C( vectContoursBdryPointels,
-						      ks, set2dPredicate, sAdj );  
+    RasterContourExtractor<Z2i::KSpace>::extractAllPointContours4C( vectContoursBdryPointels,
+								    ks, set2dPredicate, sAdj );  
     for(unsigned int i=0; i<vectContoursBdryPointels.size(); i++){
       if(vectContoursBdryPointels.at(i).size()>minSize){
 	if(select){
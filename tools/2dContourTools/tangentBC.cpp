@@ -53,6 +53,7 @@
 
 //Estimators
 #include "DGtal/geometry/2d/BinomialConvolver.h"
+#include "DGtal/geometry/2d/estimators/BatchContourEstimator.h"
 
 using namespace DGtal;
 
@@ -101,41 +102,40 @@ int main( int argc, char** argv )
     vector< FreemanChain > vectFcs =  
       PointListReader< Point >:: getFreemanChainsFromFile<Integer> (fileName); 
 
+    // Binomial
+    typedef BinomialConvolver<ConstIteratorOnPoints, double> MyBinomialConvolver;
+    typedef 
+      TangentFromBinomialConvolverFunctor< MyBinomialConvolver, RealPoint >
+      TangentBCFct;
+    typedef BinomialConvolverEstimator< MyBinomialConvolver, TangentBCFct> 
+      BCTangentEstimator;
+    BatchContourEstimator<BCTangentEstimator> batch( h );
+    batch.init( vectFcs );
+    vector<RealPoint> tangents( batch.nbValues() ); 
+    batch.eval( vectFcs, tangents.begin() ); 
+
     for(unsigned int i=0; i<vectFcs.size(); i++){
 
-      bool isClosed = vectFcs.at(i).isClosed(); 
+      bool isClosed = batch.isClosed( i ); 
       cout << "# grid curve " << i << "/" << vectFcs.size() << " "
       << ( (isClosed)?"closed":"open" ) << endl;
 
-      Storage vectPts; 
-      FreemanChain::getContourPoints( vectFcs.at(i), vectPts ); 
+      // The mask size only depends on the bounding box of the contour.
+      Storage corners; 
+      corners.push_back( batch.lowerBound( i ) ); 
+      corners.push_back( batch.upperBound( i ) ); 
+      unsigned int nbPts = batch.offset( i+1 ) - batch.offset( i ); 
 
-      // Binomial
       std::cout << "# Curvature estimation from binomial convolution" << std::endl;
-      typedef BinomialConvolver<ConstIteratorOnPoints, double> MyBinomialConvolver;
       std::cout << "# mask size = " << 
-      MyBinomialConvolver::suggestedSize( h, vectPts.begin(), vectPts.end() ) << std::endl;
-      typedef 
-	TangentFromBinomialConvolverFunctor< MyBinomialConvolver, RealPoint >
-	TangentBCFct;
-      BinomialConvolverEstimator< MyBinomialConvolver, TangentBCFct> 
-	BCTangentEstimator;
-
-      BCTangentEstimator.init( h, vectPts.begin(), vectPts.end(), isClosed );
-
-      vector<RealPoint> tangents( vectPts.size() ); 
-      BCTangentEstimator.eval( vectPts.begin(), vectPts.end(), 
-			       tangents.begin() ); 
+      MyBinomialConvolver::suggestedSize( h, corners.begin(), corners.end() ) << std::endl;
 
       // Output
       cout << "# id tangent.x tangent.y angle(atan2(y,x))" << endl;  
-      unsigned int j = 0;
-      for ( ConstIteratorOnPoints 
-	      it = vectPts.begin(), it_end = vectPts.end();
-	    it != it_end; ++it, ++j ) 
+      for ( unsigned int j = 0; j < nbPts; ++j ) 
 	{
-	  double x = tangents[ j ][ 0 ];
-	  double y = tangents[ j ][ 1 ];
+	  double x = tangents[ batch.offset( i ) + j ][ 0 ];
+	  double y = tangents[ batch.offset( i ) + j ][ 1 ];
 	  cout << j << setprecision( 15 )
 	       << " " << x << " " << y 
 	       << " " << atan2( y, x )